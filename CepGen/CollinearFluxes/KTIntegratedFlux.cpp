@@ -17,6 +17,8 @@
  */
 
 #include <cmath>
+#include <memory>
+#include <sstream>
 
 #include "CepGen/CollinearFluxes/CollinearFlux.h"
 #include "CepGen/Core/Exception.h"
@@ -26,7 +28,9 @@
 #include "CepGen/Modules/PartonFluxFactory.h"
 #include "CepGen/Physics/PDG.h"
 #include "CepGen/Utils/FunctionsWrappers.h"
+#include "CepGen/Utils/GridHandler.h"
 #include "CepGen/Utils/Limits.h"
+#include "CepGen/Utils/String.h"
 
 namespace cepgen {
   class KTIntegratedFlux : public CollinearFlux {
@@ -51,6 +55,10 @@ namespace cepgen {
                                   << "Analytical integrator: " << integr_->name() << "\n\t"
                                   << "Q^2 integration range: " << kt2_range_ << " GeV^2\n\t"
                                   << "Unintegrated flux: " << flux_->name() << ".";
+      if (const auto& tab_params = steer<ParametersList>("tabulation"); tab_params.get<bool>("enabled")) {
+        q2_table_.reset(new Table(*this, func_q2_, tab_params, "Q2range"));
+        mx2_table_.reset(new Table(*this, func_mx2_, tab_params, "MX2range"));
+      }
     }
 
     bool fragmenting() const override final { return flux_->fragmenting(); }
@@ -66,26 +74,93 @@ namespace cepgen {
           .setDescription("Type of unintegrated kT-dependent parton flux");
       desc.add<Limits>("kt2range", {0., 1.e4})
           .setDescription("kinematic range for the parton transverse virtuality, in GeV^2");
+      auto tab_desc = ParametersDescription();
+      tab_desc.add<bool>("enabled", false).setDescription("serve the flux from a precomputed interpolation table?");
+      tab_desc.add<Limits>("xRange", {1.e-5, 1.}).setDescription("tabulated parton momentum fraction range");
+      tab_desc.add<Limits>("Q2range", {1.e-6, 1.e4}).setDescription("tabulated parton virtuality range, in GeV^2");
+      tab_desc.add<Limits>("MX2range", {0.8, 1.e4}).setDescription("tabulated remnant squared mass range, in GeV^2");
+      tab_desc.add<std::vector<int> >("numNodes", {100, 100})
+          .setDescription("number of (logarithmic) nodes along the x and Q^2/MX^2 axes");
+      tab_desc += gridTabulationDescription(100, 1.e-2);
+      desc.add<ParametersDescription>("tabulation", tab_desc)
+          .setDescription("interpolation table for the integrated flux (evaluated once at initialisation)");
       return desc;
     }
 
     double fluxQ2(double x, double q2) const override {
       if (!x_range_.contains(x, true))
         return 0.;
+      if (q2_table_ && q2_table_->contains(x, q2))
+        return q2_table_->eval(x, q2) / x;
       return integr_->integrate(func_q2_, std::make_pair(x, q2), kt2_range_) / x;
     }
 
     double fluxMX2(double x, double mx2) const override {
       if (!x_range_.contains(x, true))
         return 0.;
+      if (mx2_table_ && mx2_table_->contains(x, mx2))
+        return mx2_table_->eval(x, mx2) / x;
       return integr_->integrate(func_mx2_, std::make_pair(x, mx2), kt2_range_) / x;
     }
 
   private:
+    /// Interpolation table of the \f$k_{\rm T}\f$-integrated flux (times x) in a \f$(\log x,\log v)\f$ grid
+    class Table : private GridHandler<2, 1> {
+    public:
+      explicit Table(const KTIntegratedFlux& flux,
+                     const utils::Function1D& func,
+                     const ParametersList& params,
+                     const std::string& var_range_name)
+          : GridHandler<2, 1>(GridType::logarithmic) {
+        const auto x_range = params.get<Limits>("xRange"), var_range = params.get<Limits>(var_range_name);
+        const auto num_nodes = params.get<std::vector<int> >("numNodes");
+        if (num_nodes.size() != 2 || num_nodes.at(0) < 2 || num_nodes.at(1) < 2)
+          throw CG_FATAL("KTIntegratedFlux:Table") << "Invalid number of nodes for the flux tabulation: " << num_nodes
+                                                   << ".";
+        if (x_range.min() <= 0. || var_range.min() <= 0.)
+          throw CG_FATAL("KTIntegratedFlux:Table")
+              << "Tabulation ranges must be strictly positive. Got " << x_range << " and " << var_range << ".";
+        const auto integrate = [&flux, &func](double x, double var) {
+          return flux.integr_->integrate(func, std::make_pair(x, var), flux.kt2_range_);
+        };
+        std::ostringstream os;
+        os << flux.parameters().serialise() << "|" << var_range_name;
+        auto grid_params = params;
+        if (const auto& grid_path = params.get<std::string>("gridPath"); !grid_path.empty())
+          grid_params.set<std::string>("gridPath", grid_path + "." + var_range_name);  // one file per table
+        const auto max_error = tabulate(
+            {x_range.generate(num_nodes.at(0), true), var_range.generate(num_nodes.at(1), true)},
+            [&integrate](const point_t& point) -> values_t { return {integrate(point[0], point[1])}; },
+            grid_params,
+            std::hash<std::string>()(os.str()));
+        bounds_ = boundaries();
+        CG_INFO("KTIntegratedFlux:Table").log([&](auto& log) {
+          log << "Flux tabulated in a " << coords_.at(0).size() << "x" << coords_.at(1).size() << " grid for x in "
+              << x_range << " and " << var_range_name << " " << var_range << ".";
+          if (max_error)
+            log << " Maximal relative uncertainty from "
+                << utils::s("spot check", params.get<int>("numSpotChecks"), true) << ": " << *max_error << ".";
+          else
+            log << " Table retrieved from '" << grid_params.get<std::string>("gridPath") << "'.";
+        });
+      }
+
+      /// Is the point covered by the table?
+      inline bool contains(double x, double var) const {
+        return bounds_[0].contains(std::log10(x)) && bounds_[1].contains(std::log10(var));
+      }
+      /// Interpolate the table at a given point
+      inline double eval(double x, double var) const { return GridHandler<2, 1>::eval({x, var})[0]; }
+
+    private:
+      std::array<Limits, 2> bounds_;  ///< Table boundaries, in logarithmic coordinates
+    };
+
     const std::unique_ptr<AnalyticIntegrator> integr_;
     const std::unique_ptr<KTFlux> flux_;
     const Limits kt2_range_;
     const utils::Function1D func_q2_, func_mx2_;
+    std::unique_ptr<Table> q2_table_, mx2_table_;  ///< Optional interpolation tables
   };
 }  // namespace cepgen
 REGISTER_COLLINEAR_FLUX("KTIntegrated", KTIntegratedFlux);
@@ -17,6 +17,7 @@
  */
 
 #include <chrono>
+#include <thread>
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/GeneratorWorker.h"
@@ -28,7 +29,9 @@
 #include "CepGen/Integration/ProcessIntegrand.h"
 #include "CepGen/Modules/GeneratorWorkerFactory.h"
 #include "CepGen/Modules/IntegratorFactory.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
 #include "CepGen/Process/Process.h"
+#include "CepGen/Utils/RandomGenerator.h"
 #include "CepGen/Utils/String.h"
 #include "CepGen/Utils/TimeKeeper.h"
 
@@ -54,6 +57,7 @@ namespace cepgen {
 
   void Generator::clearRun() {
     CG_DEBUG("Generator:clearRun") << "Run is set to be cleared.";
+    workers_.clear();
     worker_ = GeneratorWorkerFactory::get().build(parameters_->generation().parameters().get<ParametersList>("worker"));
     CG_DEBUG("Generator:clearRun") << "Initialised a generator worker with parameters: " << worker_->parameters()
                                    << ".";
@@ -180,10 +184,50 @@ namespace cepgen {
     // prepare the run parameters for event generation
     parameters_->initialiseModules();
     worker_->initialise();
+    initialiseWorkers();
 
     initialised_ = true;
   }
 
+  void Generator::initialiseWorkers() {
+    workers_.clear();
+    worker_->setStorageMutex(nullptr);
+    const auto num_threads = parameters_->generation().numThreads();
+    if (num_threads <= 1)
+      return;
+    const auto& worker_params = parameters_->generation().parameters().get<ParametersList>("worker");
+    if (!worker_->threadSafe()) {
+      CG_WARNING("Generator:initialiseWorkers")
+          << "Generator worker '" << worker_params.name<std::string>() << "' does not support concurrent "
+          << "generation. Events will be generated in a single thread.";
+      return;
+    }
+    CG_TICKER(parameters_->timeKeeper());
+
+    // all workers are seeded from the integrator random number generator seed, with a per-thread offset
+    auto rnd_params = integrator_->parameters().get<ParametersList>("randomGenerator");
+    const auto seed = integrator_->seed();
+    worker_->setStorageMutex(&store_mutex_);
+    for (size_t i = 1; i < num_threads; ++i) {
+      auto worker = GeneratorWorkerFactory::get().build(worker_params);
+      worker->setRunParameters(const_cast<const RunParameters*>(parameters_.get()));
+      worker->setIntegrator(integrator_.get());
+      worker->setStorageMutex(&store_mutex_);
+      // independent random streams for the worker and for its own process clone
+      worker->setRandomGenerator(
+          RandomGeneratorFactory::get().build(rnd_params.set<unsigned long long>("seed", seed + 2 * i)));
+      worker->integrand().process().setRandomGenerator(
+          RandomGeneratorFactory::get().build(rnd_params.set<unsigned long long>("seed", seed + 2 * i + 1)));
+      // stateful taming functions and event modifiers are not shared with the other workers
+      worker->integrand().cloneRunModules(i);
+      worker->integrand().setCrossSection(xsect_);
+      worker->initialiseFrom(*worker_);
+      workers_.emplace_back(std::move(worker));
+    }
+    CG_INFO("Generator:initialiseWorkers") << "Events generation will be performed in " << num_threads
+                                           << " concurrent threads.";
+  }
+
   const Event& Generator::next() {
     if (!worker_ || !initialised_)
       initialise();
@@ -216,7 +260,28 @@ namespace cepgen {
 
     //--- launch the event generation
 
-    worker_->generate(num_events, callback);
+    if (workers_.empty())
+      worker_->generate(num_events, callback);
+    else {
+      // each worker runs in its own thread, and accepted events are stored through a single (ordered) hand-off
+      std::vector<std::exception_ptr> exceptions(workers_.size() + 1);
+      auto run_worker = [&num_events, &callback](GeneratorWorker* worker, std::exception_ptr* exc) {
+        try {
+          worker->generate(num_events, callback);
+        } catch (...) {
+          *exc = std::current_exception();
+        }
+      };
+      std::vector<std::thread> threads;
+      threads.emplace_back(run_worker, worker_.get(), &exceptions.at(0));
+      for (size_t i = 0; i < workers_.size(); ++i)
+        threads.emplace_back(run_worker, workers_.at(i).get(), &exceptions.at(i + 1));
+      for (auto& thread : threads)
+        thread.join();
+      for (const auto& exc : exceptions)
+        if (exc)
+          std::rethrow_exception(exc);
+    }
 
     const double gen_time_s = tmr.elapsed();
     const double rate_ms =
@@ -24,6 +24,7 @@
 #include "CepGen/Integration/Integrator.h"
 #include "CepGen/Integration/ProcessIntegrand.h"
 #include "CepGen/Process/Process.h"
+#include "CepGen/Utils/RandomGenerator.h"
 #include "CepGen/Utils/String.h"
 #include "CepGen/Utils/TimeKeeper.h"
 
@@ -47,12 +48,33 @@ namespace cepgen {
         << "Dim-" << integrand_->size() << " " << integrator_->name() << " integrator set.";
   }
 
+  void GeneratorWorker::setRandomGenerator(std::unique_ptr<utils::RandomGenerator> rnd_gen) {
+    rnd_gen_ = std::move(rnd_gen);
+  }
+
+  double GeneratorWorker::uniform(const Limits& lim) const {
+    if (rnd_gen_)
+      return rnd_gen_->uniform(lim.min(), lim.max());
+    if (!integrator_)
+      throw CG_FATAL("GeneratorWorker:uniform") << "No random number generator nor integrator object handled!";
+    return integrator_->uniform(lim);
+  }
+
   void GeneratorWorker::generate(size_t num_events, const std::function<void(const proc::Process&)>& callback) {
     if (!params_)
       throw CG_FATAL("GeneratorWorker:generate") << "No steering parameters specified!";
     callback_proc_ = callback;
-    while (params_->numGeneratedEvents() < num_events)
+    num_events_ = num_events;
+    while (!completed())
       next();
+    num_events_ = 0;
+  }
+
+  bool GeneratorWorker::completed() const {
+    if (!store_mutex_)
+      return params_->numGeneratedEvents() >= num_events_;
+    std::lock_guard<std::mutex> lock(*store_mutex_);
+    return params_->numGeneratedEvents() >= num_events_;
   }
 
   bool GeneratorWorker::storeEvent() {
@@ -61,6 +83,14 @@ namespace cepgen {
     if (!integrand_->process().hasEvent())
       return true;
 
+    // single hand-off point for all concurrent workers; events are stored in their order of acceptance
+    std::unique_lock<std::mutex> lock;
+    if (store_mutex_)
+      lock = std::unique_lock<std::mutex>(*store_mutex_);
+    // another worker may have already reached the requested number of events
+    if (num_events_ > 0 && params_->numGeneratedEvents() >= num_events_)
+      return false;
+
     const auto& event = integrand_->process().event();
     const auto ngen = params_->numGeneratedEvents();
     if ((ngen + 1) % params_->generation().printEvery() == 0)
@@ -20,10 +20,12 @@
 #define CepGen_Core_GeneratorWorker_h
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "CepGen/Core/SteeredObject.h"
 #include "CepGen/Event/Event.h"
+#include "CepGen/Utils/Limits.h"
 
 namespace cepgen {
   class Integrator;
@@ -32,6 +34,9 @@ namespace cepgen {
   namespace proc {
     class Process;
   }
+  namespace utils {
+    class RandomGenerator;
+  }
   /// Monte-Carlo generator instance
   class GeneratorWorker : public SteeredObject<GeneratorWorker> {
   public:
@@ -45,6 +50,10 @@ namespace cepgen {
     void setRunParameters(const RunParameters*);
     /// Specify the integrator instance handled by the mother generator
     void setIntegrator(const Integrator* integ);
+    /// Specify a worker-local random number generator (if unset, the integrator one is used)
+    void setRandomGenerator(std::unique_ptr<utils::RandomGenerator>);
+    /// Specify the mutex protecting the events hand-off between concurrent workers
+    void setStorageMutex(std::mutex* mutex) { store_mutex_ = mutex; }
     /// Launch the event generation
     /// \param[in] num_events Number of events to generate
     /// \param[in] callback The callback function applied on every event generated
@@ -54,6 +63,11 @@ namespace cepgen {
 
     /// Initialise the generation parameters
     virtual void initialise() = 0;
+    /// Initialise the generation parameters from an already initialised worker
+    /// \note By default, a full initialisation is performed
+    virtual void initialiseFrom(const GeneratorWorker&) { initialise(); }
+    /// Can several instances of this worker run concurrently in separate threads?
+    virtual bool threadSafe() const { return false; }
     /// Generate a single event
     virtual bool next() = 0;
 
@@ -62,6 +76,8 @@ namespace cepgen {
     /// \param[in] callback The callback function for every event generated
     /// \return A boolean stating whether or not the event was successfully saved
     bool storeEvent();
+    /// Generate a uniformly distributed random number from the worker-local (or integrator) engine
+    double uniform(const Limits& = {0., 1.}) const;
 
     /// Pointer to the mother-handled integrator instance
     /// \note NOT owning
@@ -73,6 +89,16 @@ namespace cepgen {
     std::unique_ptr<ProcessIntegrand> integrand_;
     /// Callback function on process for each new event
     std::function<void(const proc::Process&)> callback_proc_{nullptr};
+    /// Worker-local random number generator
+    std::unique_ptr<utils::RandomGenerator> rnd_gen_;
+
+  private:
+    bool completed() const;  ///< Has the number of events requested already been generated?
+
+    /// Mutex protecting the events storage in multi-threaded mode
+    /// \note NOT owning
+    std::mutex* store_mutex_{nullptr};
+    size_t num_events_{0};  ///< Number of events to generate in this run (0 if unbounded)
   };
 }  // namespace cepgen
 
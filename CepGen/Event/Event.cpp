@@ -36,6 +36,7 @@ namespace cepgen {
     evtcontent_ = oth.evtcontent_;
     compressed_ = oth.compressed_;
     metadata = oth.metadata;
+    ids_index_ = oth.ids_index_;  // locations are relative to the role blocks, hence still valid in the copy
     return *this;
   }
 
@@ -80,6 +81,7 @@ namespace cepgen {
   void Event::clear() {
     particles_.clear();
     metadata.clear();
+    ids_index_.clear();
   }
 
   void Event::freeze() {
@@ -89,6 +91,7 @@ namespace cepgen {
       evtcontent_.op1 = particles_[Particle::OutgoingBeam1].size();
     if (particles_.count(Particle::OutgoingBeam2) > 0)
       evtcontent_.op2 = particles_[Particle::OutgoingBeam2].size();
+    rebuildIndex();  // the primordial block is now complete
   }
 
   void Event::restore() {
@@ -151,6 +154,8 @@ namespace cepgen {
     return out;
   }
 
+  ParticlesMap& Event::map() { return particles_; }
+
   ParticlesRefs Event::operator[](Particle::Role role) {
     ParticlesRefs out;
     //--- retrieve all particles with a given role
@@ -201,23 +206,60 @@ namespace cepgen {
   }
 
   Particle& Event::operator[](int id) {
-    for (auto& role_part : particles_)
-      for (auto& part : role_part.second)
-        if (part.id() == id)
-          return part;
+    const auto* part = findParticle(id);
+    if (!part)
+      throw CG_FATAL("Event") << "Failed to retrieve the particle with id=" << id << ".";
+    if ((size_t)id >= ids_index_.size() || locatedParticle(ids_index_[id], id) != part)
+      rebuildIndex();  // index is outdated (e.g. identifiers modified in-place, particles added through map())
+    return const_cast<Particle&>(*part);
+  }
 
+  const Particle& Event::operator()(int id) const {
+    if (const auto* part = findParticle(id); part)
+      return *part;
     throw CG_FATAL("Event") << "Failed to retrieve the particle with id=" << id << ".";
   }
 
-  const Particle& Event::operator()(int id) const {
-    for (const auto& role_part : particles_) {
+  const Particle* Event::findParticle(int id) const {
+    if (id < 0)
+      return nullptr;
+    if ((size_t)id < ids_index_.size())
+      if (const auto* part = locatedParticle(ids_index_[id], id); part)
+        return part;
+    for (const auto& role_part : particles_) {  // index is outdated, look for the particle in all role blocks
       auto it = std::find_if(
           role_part.second.begin(), role_part.second.end(), [&id](const auto& part) { return part.id() == id; });
       if (it != role_part.second.end())
-        return *it;
+        return &(*it);
     }
+    return nullptr;
+  }
 
-    throw CG_FATAL("Event") << "Failed to retrieve the particle with id=" << id << ".";
+  const Particle* Event::locatedParticle(const ParticleLocation& loc, int id) const {
+    if (loc.role == Particle::Role::UnknownRole)
+      return nullptr;
+    const auto it = particles_.find(loc.role);
+    if (it == particles_.end() || loc.index >= it->second.size() || it->second[loc.index].id() != id)
+      return nullptr;
+    return &it->second[loc.index];
+  }
+
+  void Event::rebuildIndex() {
+    ids_index_.clear();
+    for (const auto& role_part : particles_)
+      for (size_t i = 0; i < role_part.second.size(); ++i)
+        indexParticle(role_part.first, i);
+  }
+
+  void Event::indexParticle(Particle::Role role, size_t index) {
+    const auto id = particles_[role][index].id();
+    if (id < 0)
+      return;
+    if ((size_t)id >= ids_index_.size())
+      ids_index_.resize(id + 1);
+    if (const auto* part = locatedParticle(ids_index_[id], id); part && part != &particles_[role][index])
+      return;  // first particle with this identifier is kept
+    ids_index_[id] = ParticleLocation{role, index};
   }
 
   ParticlesRefs Event::operator[](const ParticlesIds& ids) {
@@ -292,6 +334,7 @@ namespace cepgen {
       part_with_same_role = {part};
     else
       part_with_same_role.emplace_back(part);
+    indexParticle(part.role(), part_with_same_role.size() - 1);
     return std::ref(part_with_same_role.back());
   }
 
@@ -308,6 +351,7 @@ namespace cepgen {
 
   Particles Event::particles() const {
     Particles out;
+    out.reserve(size());
     for (const auto& role_part : particles_)
       out.insert(out.end(), role_part.second.begin(), role_part.second.end());
 
@@ -341,28 +385,29 @@ namespace cepgen {
 
   void Event::checkKinematics() const {
     // check the kinematics through parentage
-    for (const auto& part : particles()) {
-      ParticlesIds daughters = part.daughters();
-      if (daughters.empty())
-        continue;
-      Momentum ptot;
-      for (const auto& daughter : daughters) {
-        const auto& d = operator()(daughter);
-        const auto mothers = d.mothers();
-        ptot += d.momentum();
-        if (mothers.size() < 2)
+    for (const auto& role_part : particles_)
+      for (const auto& part : role_part.second) {
+        const auto& daughters = part.daughters();
+        if (daughters.empty())
           continue;
-        for (const auto& moth : mothers)
-          if (moth != part.id())
-            ptot -= operator()(moth).momentum();
-      }
-      const double mass_diff = (ptot - part.momentum()).mass();
-      if (fabs(mass_diff) > MIN_PRECISION) {
-        dump();
-        throw CG_FATAL("Event") << "Error in momentum balance for particle " << part.id() << ": mdiff = " << mass_diff
-                                << ".";
+        Momentum ptot;
+        for (const auto& daughter : daughters) {
+          const auto& d = operator()(daughter);
+          const auto& mothers = d.mothers();
+          ptot += d.momentum();
+          if (mothers.size() < 2)
+            continue;
+          for (const auto& moth : mothers)
+            if (moth != part.id())
+              ptot -= operator()(moth).momentum();
+        }
+        const double mass_diff = (ptot - part.momentum()).mass();
+        if (fabs(mass_diff) > MIN_PRECISION) {
+          dump();
+          throw CG_FATAL("Event") << "Error in momentum balance for particle " << part.id()
+                                  << ": mdiff = " << mass_diff << ".";
+        }
       }
-    }
   }
 
   void Event::dump() const { CG_INFO("Event") << *this; }
@@ -373,7 +418,7 @@ namespace cepgen {
 
     Momentum p_total;
     for (const auto& part : parts) {
-      const ParticlesIds mothers = part.mothers();
+      const auto& mothers = part.mothers();
       {
         std::ostringstream oss_pdg;
         if (part.pdgId() == PDG::invalid && !mothers.empty()) {
@@ -65,7 +65,7 @@ namespace cepgen {
     size_t size() const;                        ///< Number of particles in the event
     Particles particles() const;                ///< Vector of all particles in the event
     Particles stableParticles() const;          ///< Vector of all stable particles in the event
-    ParticlesMap& map() { return particles_; }  ///< Internal particles map retrieval operator
+    ParticlesMap& map();                        ///< Internal particles map retrieval operator
 
     /// List of references to Particle objects corresponding to a certain role in the process kinematics
     /// \param[in] role The role the particles have to play in the process
@@ -130,7 +130,27 @@ namespace cepgen {
   private:
     static constexpr double MIN_PRECISION = 1.e-10;
     void checkKinematics() const;  ///< Check if the event kinematics is properly defined
-    ParticlesMap particles_;       ///< List of particles in the event, mapped to their role in the process
+    /// Particle object with a given unique identifier, or null pointer if not found
+    /// \note The identifiers index is only used as a hint: any location it returns is checked against the particle
+    ///   identifier, and the role blocks are scanned if it is missing or outdated
+    const Particle* findParticle(int id) const;
+    void rebuildIndex();  ///< Recompute the identifier-to-particle location index
+    /// Register the location of a particle in the identifiers index
+    void indexParticle(Particle::Role role, size_t index);
+    /// List of particles in the event, mapped to their role in the process
+    /// \note Particles are stored in contiguous per-role blocks, so that references to particles are not
+    ///  invalidated when other particles are added to the event
+    ParticlesMap particles_;
+    /// Location of a particle in the per-role storage
+    struct ParticleLocation {
+      Particle::Role role{Particle::Role::UnknownRole};  ///< Role block hosting the particle
+      size_t index{0};                                   ///< Position in the role block
+    };
+    /// Particles locations, indexed by their unique identifier
+    /// \note Only updated by the non-const members, so that concurrent const accesses never modify the event
+    std::vector<ParticleLocation> ids_index_;
+    /// Particle object at a given location, or null pointer if it does not hold the expected identifier
+    const Particle* locatedParticle(const ParticleLocation& loc, int id) const;
     /// Typical event indices structure
     struct NumParticles {
       size_t cs{0};   ///< Index of the first central system particle
@@ -16,6 +16,7 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <iomanip>
 
 #include "CepGen/Event/Particle.h"
@@ -24,23 +25,61 @@
 #include "CepGen/Utils/String.h"
 
 namespace cepgen {
+  ParticlesIds::ParticlesIds(std::initializer_list<int> ids) {
+    for (const auto& id : ids)
+      insert(id);
+  }
+
+  bool ParticlesIds::operator==(const ParticlesIds& oth) const {
+    return size_ == oth.size_ && std::equal(begin(), end(), oth.begin());
+  }
+
+  std::pair<ParticlesIds::const_iterator, bool> ParticlesIds::insert(int id) {
+    const auto pos = std::lower_bound(begin(), end(), id) - begin();
+    if (pos < (long)size_ && data()[pos] == id)  // already present
+      return std::make_pair(begin() + pos, false);
+    if (size_ == NUM_INLINE)  // inline storage exhausted, move everything to the heap
+      heap_.assign(inline_.begin(), inline_.end());
+    if (size_ >= NUM_INLINE)
+      heap_.insert(heap_.begin() + pos, id);
+    else {
+      std::copy_backward(inline_.begin() + pos, inline_.begin() + size_, inline_.begin() + size_ + 1);
+      inline_[pos] = id;
+    }
+    ++size_;
+    return std::make_pair(begin() + pos, true);
+  }
+
+  size_t ParticlesIds::erase(int id) {
+    const auto it = find(id);
+    if (it == end())
+      return 0;
+    const auto pos = it - begin();
+    if (size_ > NUM_INLINE) {
+      heap_.erase(heap_.begin() + pos);
+      if (size_ - 1 == NUM_INLINE) {  // back to inline storage
+        std::copy(heap_.begin(), heap_.end(), inline_.begin());
+        heap_.clear();
+      }
+    } else
+      std::copy(inline_.begin() + pos + 1, inline_.begin() + size_, inline_.begin() + pos);
+    --size_;
+    return 1;
+  }
+
+  void ParticlesIds::clear() {
+    heap_.clear();
+    size_ = 0;
+  }
+
+  ParticlesIds::const_iterator ParticlesIds::find(int id) const {
+    const auto it = std::lower_bound(begin(), end(), id);
+    return (it != end() && *it == id) ? it : end();
+  }
+
   Particle::Particle(Role role, pdgid_t pdgId, Status st) : role_(role), status_((int)st), pdg_id_(pdgId) {
     if (PDG::get().has(pdg_id_))
-      phys_prop_ = PDG::get()(pdg_id_);
-  }
-
-  Particle::Particle(const Particle& part)
-      : id_(part.id_),
-        charge_sign_(part.charge_sign_),
-        momentum_(part.momentum_),
-        helicity_(part.helicity_),
-        role_(part.role_),
-        status_(part.status_),
-        mothers_(part.mothers_),
-        daughters_(part.daughters_),
-        pdg_id_(part.pdg_id_) {
-    if (PDG::get().has(pdg_id_))
-      phys_prop_ = PDG::get()(pdg_id_);
+      phys_prop_ = &PDG::get()(pdg_id_);
   }
 
   bool Particle::operator<(const Particle& rhs) const { return id_ >= 0 && rhs.id_ > 0 && id_ < rhs.id_; }
@@ -53,7 +92,7 @@ namespace cepgen {
     return true;
   }
 
-  float Particle::charge() const { return charge_sign_ * phys_prop_.charge / 3.; }
+  float Particle::charge() const { return phys_prop_ ? charge_sign_ * phys_prop_->charge / 3. : 0.; }
 
   Particle& Particle::clearMothers() {
     mothers_.clear();
@@ -68,7 +107,7 @@ namespace cepgen {
     if (ret.second) {
       CG_DEBUG_LOOP("Particle") << "Particle " << id() << " (pdgId=" << part.pdg_id_ << ") "
                                 << "is a new mother of " << id_ << " (pdgId=" << pdg_id_ << ").";
-      if (!utils::contains(part.daughters_, id_))
+      if (part.daughters_.count(id_) == 0)
         part.addDaughter(*this);
     }
     return *this;
@@ -94,7 +133,7 @@ namespace cepgen {
     if (ret.second) {
       CG_DEBUG_LOOP("Particle") << "Particle " << part.role_ << " (pdgId=" << part.pdg_id_ << ") "
                                 << "is a new daughter of " << role_ << " (pdgId=" << pdg_id_ << ").";
-      if (!utils::contains(part.mothers_, id_))
+      if (part.mothers_.count(id_) == 0)
         part.addMother(*this);
     }
     return *this;
@@ -103,7 +142,7 @@ namespace cepgen {
   Particle& Particle::setMomentum(const Momentum& mom, bool offshell) {
     momentum_ = mom;
     if (!offshell)
-      momentum_.computeEnergyFromMass(phys_prop_.mass);
+      momentum_.computeEnergyFromMass(phys_prop_ ? phys_prop_->mass : 0.);
     return *this;
   }
 
@@ -119,10 +158,11 @@ namespace cepgen {
   Particle& Particle::setPdgId(long pdg) {
     pdg_id_ = labs(pdg);
     if (PDG::get().has(pdg_id_)) {
-      phys_prop_ = PDG::get()(pdg_id_);
+      phys_prop_ = &PDG::get()(pdg_id_);
       CG_DEBUG("Particle:setPdgId") << "Particle PDG id set to " << pdg_id_ << ", "
-                                    << "properties set " << phys_prop_ << ".";
-    }
+                                    << "properties set " << *phys_prop_ << ".";
+    } else
+      phys_prop_ = nullptr;
     switch (pdg_id_) {
       case 0:
         charge_sign_ = 0.;
@@ -142,7 +182,7 @@ namespace cepgen {
   Particle& Particle::setPdgId(pdgid_t pdg, short ch) { return setPdgId(long(pdg * (ch == 0 ? 1 : ch / abs(ch)))); }
 
   int Particle::integerPdgId() const {
-    const float ch = phys_prop_.charge / 3.;
+    const float ch = phys_prop_ ? phys_prop_->charge / 3. : 0.;
     if (ch == 0)
       return static_cast<int>(pdg_id_);
     return static_cast<int>(pdg_id_) * charge_sign_ * (ch / fabs(ch));
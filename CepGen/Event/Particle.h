@@ -19,8 +19,10 @@
 #ifndef CepGen_Event_Particle_h
 #define CepGen_Event_Particle_h
 
-#include <set>
+#include <array>
+#include <iterator>
 #include <unordered_map>
+#include <vector>
 
 #include "CepGen/Physics/Constants.h"
 #include "CepGen/Physics/Momentum.h"
@@ -28,8 +30,47 @@
 #include "CepGen/Utils/Hasher.h"
 
 namespace cepgen {
-  /// A set of integer-type particle identifiers
-  typedef std::set<int> ParticlesIds;
+  /// An ordered set of integer-type particle identifiers
+  /// \note The first few identifiers are stored inline, as most particles only have a handful of parents/children
+  class ParticlesIds {
+  public:
+    typedef int value_type;
+    typedef const int* const_iterator;
+    typedef const_iterator iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator reverse_iterator;
+
+    ParticlesIds() = default;
+    ParticlesIds(std::initializer_list<int>);
+
+    bool operator==(const ParticlesIds&) const;
+    inline bool operator!=(const ParticlesIds& oth) const { return !(*this == oth); }
+
+    /// Add an identifier to the set, if not already present
+    /// \return Position of the identifier, and a boolean stating if it was not present before
+    std::pair<const_iterator, bool> insert(int);
+    size_t erase(int);  ///< Remove an identifier from the set
+    void clear();       ///< Remove all identifiers from the set
+
+    const_iterator find(int) const;  ///< Position of an identifier in the set
+    inline size_t count(int id) const { return find(id) != end() ? 1 : 0; }
+    inline size_t size() const { return size_; }
+    inline bool empty() const { return size_ == 0; }
+
+    inline const_iterator begin() const { return data(); }
+    inline const_iterator end() const { return data() + size_; }
+    inline const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    inline const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  private:
+    static constexpr size_t NUM_INLINE = 4;  ///< Number of identifiers stored without heap allocation
+    inline const int* data() const { return size_ <= NUM_INLINE ? inline_.data() : heap_.data(); }
+    inline int* data() { return size_ <= NUM_INLINE ? inline_.data() : heap_.data(); }
+
+    std::array<int, NUM_INLINE> inline_{};
+    std::vector<int> heap_;  ///< Storage for all identifiers, once the inline capacity is exceeded
+    size_t size_{0};
+  };
 
   /// Kinematic information for one particle
   class Particle {
@@ -71,8 +112,7 @@ namespace cepgen {
     /// \param[in] id PDG identifier
     /// \param[in] st Current status
     explicit Particle(Role role = Role::UnknownRole, pdgid_t id = 0, Status st = Status::Undefined);
-    /// Copy constructor
-    Particle(const Particle&);
+    Particle(const Particle&) = default;  ///< Copy constructor
     inline ~Particle() = default;
     Particle& operator=(const Particle&) = default;  ///< Assignment operator
     /// Comparison operator (from unique identifier)
@@ -169,7 +209,7 @@ namespace cepgen {
     Particle& addMother(Particle& part);
     /// Get the unique identifier to the mother particle from which this particle arises
     /// \return An integer representing the unique identifier to the mother of this particle in the event
-    inline ParticlesIds mothers() const { return mothers_; }
+    inline const ParticlesIds& mothers() const { return mothers_; }
     /// Remove the decay products linking
     Particle& clearDaughters();
     /**
@@ -182,7 +222,7 @@ namespace cepgen {
     inline size_t numDaughters() const { return daughters_.size(); };
     /// Get an identifiers list all daughter particles
     /// \return An integer vector containing all the daughters' unique identifier in the event
-    inline ParticlesIds daughters() const { return daughters_; }
+    inline const ParticlesIds& daughters() const { return daughters_; }
 
     // --- global particle information extraction
 
@@ -208,8 +248,8 @@ namespace cepgen {
     ParticlesIds daughters_{};
     /// PDG id
     pdgid_t pdg_id_{(pdgid_t)0};
-    /// Collection of standard, bare-level physical properties
-    ParticleProperties phys_prop_;
+    /// Collection of standard, bare-level physical properties (interned in, and owned by the PDG library)
+    const ParticleProperties* phys_prop_{nullptr};
   };
 
   // --- particle containers
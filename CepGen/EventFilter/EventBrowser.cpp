@@ -32,18 +32,24 @@ namespace cepgen {
                                                      std::regex_constants::extended);
 
     double EventBrowser::get(const Event& ev, const std::string& var) const {
+      auto it = accessors_.find(var);
+      if (it == accessors_.end())
+        it = accessors_.emplace(var, compile(var)).first;
+      return it->second(ev);
+    }
+
+    EventBrowser::Accessor EventBrowser::compile(const std::string& var) const {
       std::smatch sm;
       //--- particle-level variables (indexed by integer id)
       if (std::regex_match(var, sm, rgx_select_id_)) {
-        const auto& var_name = sm[1].str();
-        const auto& part = ev(std::stoul(sm[2].str()));
-        return variable(ev, part, var_name);
+        const int id = std::stoul(sm[2].str());
+        return [id, var_acc = variable(sm[1].str())](const Event& ev) { return var_acc(ev, ev(id)); };
       }
       if (std::regex_match(var, sm, rgx_select_id2_)) {
-        const auto& var_name = sm[1].str();
-        const auto& part1 = ev(std::stoul(sm[2].str()));
-        const auto& part2 = ev(std::stoul(sm[3].str()));
-        return variable(ev, part1, part2, var_name);
+        const int id1 = std::stoul(sm[2].str()), id2 = std::stoul(sm[3].str());
+        return [id1, id2, var_acc = pairVariable(sm[1].str())](const Event& ev) {
+          return var_acc(ev, ev(id1), ev(id2));
+        };
       }
       //--- particle-level variables (indexed by role)
       const auto check_role = [&](const std::string& role, const std::string& var) -> bool {
@@ -54,84 +60,81 @@ namespace cepgen {
         return ret;
       };
       if (std::regex_match(var, sm, rgx_select_role_)) {
-        const auto& var_name = sm[1].str();
         const auto& str_role = sm[2].str();
         if (!check_role(str_role, var))
-          return INVALID_OUTPUT;
-        const auto& part = ev(role_str_.at(str_role))[0];
-        return variable(ev, part, var_name);
+          return [](const Event&) { return INVALID_OUTPUT; };
+        return [role = role_str_.at(str_role), var_acc = variable(sm[1].str())](const Event& ev) {
+          return var_acc(ev, ev(role)[0]);
+        };
       }
       if (std::regex_match(var, sm, rgx_select_role2_)) {
-        const auto& var_name = sm[1].str();
         const auto& str_role1 = sm[2].str();
         const auto& str_role2 = sm[3].str();
         if (!check_role(str_role1, var) || !check_role(str_role2, var))
-          return INVALID_OUTPUT;
-        const auto& part1 = ev(role_str_.at(str_role1))[0];
-        const auto& part2 = ev(role_str_.at(str_role2))[0];
-        return variable(ev, part1, part2, var_name);
+          return [](const Event&) { return INVALID_OUTPUT; };
+        return [role1 = role_str_.at(str_role1), role2 = role_str_.at(str_role2), var_acc = pairVariable(sm[1].str())](
+                   const Event& ev) { return var_acc(ev, ev(role1)[0], ev(role2)[0]); };
       }
       //--- event-level variables
-      return variable(ev, var);
+      return eventVariable(var);
     }
 
-    double EventBrowser::variable(const Event& ev, const Particle& part, const std::string& var) const {
-      if (m_mom_str_.count(var)) {
-        const auto& meth = m_mom_str_.at(var);
-        return (part.momentum().*meth)();
-      }
-      if (var == "xi") {
-        const auto& moth = part.mothers();
-        if (moth.empty()) {
-          CG_WARNING("EventBrowser") << "Failed to retrieve parent particle to compute xi "
-                                     << "for the following particle:\n"
-                                     << part;
-          return INVALID_OUTPUT;
-        }
-        return 1. - part.momentum().energy() / ev(int(*moth.begin())).momentum().energy();
-      }
+    EventBrowser::SingleAccessor EventBrowser::variable(const std::string& var) const {
+      if (m_mom_str_.count(var))
+        return [meth = m_mom_str_.at(var)](const Event&, const Particle& part) { return (part.momentum().*meth)(); };
+      if (var == "xi")
+        return [](const Event& ev, const Particle& part) {
+          const auto& moth = part.mothers();
+          if (moth.empty()) {
+            CG_WARNING("EventBrowser") << "Failed to retrieve parent particle to compute xi "
+                                       << "for the following particle:\n"
+                                       << part;
+            return INVALID_OUTPUT;
+          }
+          return 1. - part.momentum().energy() / ev(int(*moth.begin())).momentum().energy();
+        };
       if (var == "pdg")
-        return (double)part.integerPdgId();
+        return [](const Event&, const Particle& part) { return (double)part.integerPdgId(); };
       if (var == "charge")
-        return part.charge();
+        return [](const Event&, const Particle& part) { return part.charge(); };
       if (var == "status")
-        return (double)part.status();
+        return [](const Event&, const Particle& part) { return (double)part.status(); };
       throw CG_ERROR("EventBrowser") << "Failed to retrieve variable \"" << var << "\".";
     }
 
-    double EventBrowser::variable(const Event&,
-                                  const Particle& part1,
-                                  const Particle& part2,
-                                  const std::string& var) const {
-      if (m_two_mom_str_.count(var)) {
-        const auto& meth = m_two_mom_str_.at(var);
-        return (part1.momentum().*meth)(part2.momentum());
-      }
-      if (m_mom_str_.count(var)) {
-        const auto& meth = m_mom_str_.at(var);
-        return ((part1.momentum() + part2.momentum()).*meth)();
-      }
+    EventBrowser::PairAccessor EventBrowser::pairVariable(const std::string& var) const {
+      if (m_two_mom_str_.count(var))
+        return [meth = m_two_mom_str_.at(var)](const Event&, const Particle& part1, const Particle& part2) {
+          return (part1.momentum().*meth)(part2.momentum());
+        };
+      if (m_mom_str_.count(var))
+        return [meth = m_mom_str_.at(var)](const Event&, const Particle& part1, const Particle& part2) {
+          return ((part1.momentum() + part2.momentum()).*meth)();
+        };
       if (var == "acop")
-        return 1. - fabs(part1.momentum().deltaPhi(part2.momentum()) * M_1_PI);
+        return [](const Event&, const Particle& part1, const Particle& part2) {
+          return 1. - fabs(part1.momentum().deltaPhi(part2.momentum()) * M_1_PI);
+        };
       throw CG_ERROR("EventBrowser") << "Failed to retrieve variable \"" << var << "\".";
     }
 
-    double EventBrowser::variable(const Event& ev, const std::string& var) {
+    EventBrowser::Accessor EventBrowser::eventVariable(const std::string& var) {
       if (var == "np")
-        return (double)ev.size();
+        return [](const Event& ev) { return (double)ev.size(); };
       //if ( var == "nev" )
       //  return (double)num_evts_+1;
-      if (var == "nob1" || var == "nob2") {
-        const auto& bparts = ev(var == "nob1" ? Particle::Role::OutgoingBeam1 : Particle::Role::OutgoingBeam2);
-        return (double)std::count_if(
-            bparts.begin(), bparts.end(), [](const auto& part) { return (int)part.status() > 0; });
-      }
+      if (var == "nob1" || var == "nob2")
+        return [role = var == "nob1" ? Particle::Role::OutgoingBeam1 : Particle::Role::OutgoingBeam2](const Event& ev) {
+          const auto& bparts = ev(role);
+          return (double)std::count_if(
+              bparts.begin(), bparts.end(), [](const auto& part) { return (int)part.status() > 0; });
+        };
       if (var == "met")
-        return ev.missingMomentum().pt();
+        return [](const Event& ev) { return ev.missingMomentum().pt(); };
       if (var == "mephi")
-        return ev.missingMomentum().phi();
+        return [](const Event& ev) { return ev.missingMomentum().phi(); };
       if (utils::startsWith(var, "meta:"))
-        return ev.metadata(var.substr(5));
+        return [key = var.substr(5)](const Event& ev) { return (double)ev.metadata(key); };
       throw CG_ERROR("EventBrowser") << "Failed to retrieve the event-level variable \"" << var << "\".";
     }
   }  // namespace utils
@@ -19,7 +19,9 @@
 #ifndef CepGen_EventFilter_EventBrowser_h
 #define CepGen_EventFilter_EventBrowser_h
 
+#include <functional>
 #include <regex>
+#include <unordered_map>
 
 #include "CepGen/Event/Particle.h"
 
@@ -34,16 +36,28 @@ namespace cepgen {
     class EventBrowser {
     public:
       EventBrowser() = default;
+
+      /// A variable accessor, parsed once from its string definition, and evaluated for each event
+      typedef std::function<double(const Event&)> Accessor;
+      /// Parse a variable definition (e.g. "pt(cs)", "m(ob1,ob2)", "np") into an event accessor
+      Accessor compile(const std::string& var) const;
+
       /// Get/compute a variable value
+      /// \note Variable definitions are parsed on first use, and their accessors are cached in this
+      ///  (non-thread-safe) browser for all subsequent calls
       double get(const Event& ev, const std::string& var) const;
 
     private:
-      /// Retrieve a named variable from a particle
-      double variable(const Event&, const Particle&, const std::string&) const;
-      /// Retrieve a named variable from a two-particle system
-      double variable(const Event&, const Particle&, const Particle&, const std::string&) const;
-      /// Retrieve a named variable from the whole event
-      static double variable(const Event&, const std::string&);
+      typedef std::function<double(const Event&, const Particle&)> SingleAccessor;
+      typedef std::function<double(const Event&, const Particle&, const Particle&)> PairAccessor;
+      /// Build an accessor to a named variable from a particle
+      SingleAccessor variable(const std::string&) const;
+      /// Build an accessor to a named variable from a two-particle system
+      PairAccessor pairVariable(const std::string&) const;
+      /// Build an accessor to a named variable from the whole event
+      static Accessor eventVariable(const std::string&);
+
+      mutable std::unordered_map<std::string, Accessor> accessors_;  ///< Already parsed variables accessors
 
       static const std::regex rgx_select_id_, rgx_select_id2_, rgx_select_role_, rgx_select_role2_;
       static constexpr double INVALID_OUTPUT = -999.;
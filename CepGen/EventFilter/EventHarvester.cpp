@@ -52,13 +52,13 @@ namespace cepgen {
         auto hist = utils::Hist1D(hvar.set<std::string>("name", name));
         hist.xAxis().setLabel(vars.at(0));
         hist.yAxis().setLabel("d$\\sigma$/d" + vars.at(0) + " (pb/bin)");
-        hists_.emplace_back(Hist1DInfo{vars.at(0), hist, log});
+        hists_.emplace_back(Hist1DInfo{browser_->compile(vars.at(0)), hist, log});
       } else if (vars.size() == 2) {  // 2D histogram
         auto hist = utils::Hist2D(hvar.set<std::string>("name", utils::sanitise(name)));
         hist.xAxis().setLabel(vars.at(0));
         hist.yAxis().setLabel(vars.at(1));
         hist.zAxis().setLabel("d$^2$$\\sigma$/d" + vars.at(0) + "/d" + vars.at(1) + " (pb/bin)");
-        hists2d_.emplace_back(Hist2DInfo{vars.at(0), vars.at(1), hist, log});
+        hists2d_.emplace_back(Hist2DInfo{browser_->compile(vars.at(0)), browser_->compile(vars.at(1)), hist, log});
       }
     }
     if (save_hists_ && !hists_.empty())
@@ -108,9 +108,9 @@ namespace cepgen {
   bool EventHarvester::operator<<(const Event& ev) {
     // increment the corresponding histograms
     for (auto& h_var : hists_)
-      h_var.hist.fill(browser_->get(ev, h_var.var));
+      h_var.hist.fill(h_var.var(ev));
     for (auto& h_var : hists2d_)
-      h_var.hist.fill(browser_->get(ev, h_var.var1), browser_->get(ev, h_var.var2));
+      h_var.hist.fill(h_var.var1(ev), h_var.var2(ev));
     ++num_evts_;
     return true;
   }
@@ -17,6 +17,7 @@
  */
 
 #include <fstream>
+#include <functional>
 
 #include "CepGen/EventFilter/EventExporter.h"
 #include "CepGen/Utils/Histogram.h"
@@ -59,7 +60,7 @@ namespace cepgen {
 
     /// 1D histogram definition
     struct Hist1DInfo {
-      std::string var;
+      std::function<double(const Event&)> var;  ///< Pre-parsed variable accessor
       utils::Hist1D hist;
       bool log;
     };
@@ -67,7 +68,7 @@ namespace cepgen {
     std::vector<Hist1DInfo> hists_;
     /// 2D histogram definition
     struct Hist2DInfo {
-      std::string var1, var2;
+      std::function<double(const Event&)> var1, var2;  ///< Pre-parsed variables accessors
       utils::Hist2D hist;
       bool log;
     };
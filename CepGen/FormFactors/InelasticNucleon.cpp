@@ -17,7 +17,9 @@
  */
 
 #include <cmath>
+#include <sstream>
 
+#include "CepGen/Core/Exception.h"
 #include "CepGen/FormFactors/Parameterisation.h"
 #include "CepGen/Integration/AnalyticIntegrator.h"
 #include "CepGen/Modules/AnalyticIntegratorFactory.h"
@@ -25,7 +27,9 @@
 #include "CepGen/Modules/StructureFunctionsFactory.h"
 #include "CepGen/Physics/Utils.h"
 #include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/GridHandler.h"
 #include "CepGen/Utils/Message.h"
+#include "CepGen/Utils/String.h"
 
 namespace cepgen {
   namespace formfac {
@@ -52,6 +56,8 @@ namespace cepgen {
                                     << steer<ParametersList>("structureFunctions") << "\n"
                                     << " * integrator algorithm: " << steer<ParametersList>("integrator") << "\n"
                                     << " * diffractive mass range: " << steer<Limits>("mxRange") << " GeV^2.";
+        if (const auto& tab_params = steer<ParametersList>("tabulation"); tab_params.get<bool>("enabled"))
+          tabulate(tab_params);
       }
 
       static ParametersDescription description() {
@@ -64,23 +70,76 @@ namespace cepgen {
         desc.add<bool>("computeFM", false).setDescription("compute, or neglect the F2/xbj^3 term");
         desc.add<Limits>("mxRange", Limits{1.0732 /* mp + mpi0 */, 20.})
             .setDescription("diffractive mass range (in GeV/c^2)");
+        auto tab_desc = ParametersDescription();
+        tab_desc.add<bool>("enabled", false).setDescription("serve the form factors from a precomputed Q^2 table?");
+        tab_desc.add<Limits>("Q2range", {1.e-6, 1.e4}).setDescription("tabulated virtuality range (in GeV^2)");
+        tab_desc.add<int>("numNodes", 200).setDescription("number of (logarithmic) nodes along the Q^2 axis");
+        tab_desc += gridTabulationDescription(50, 1.e-3);
+        desc.add<ParametersDescription>("tabulation", tab_desc)
+            .setDescription("interpolation table for the form factors (evaluated once at initialisation)");
         return desc;
       }
 
     protected:
       void eval() override {
-        const auto inv_q2 = 1. / q2_;
-        const auto fe = integr_->integrate(eval_fe_, mx2_range_) * inv_q2;
-        const auto fm = compute_fm_ ? integr_->integrate(eval_fm_, mx2_range_) * inv_q2 : 0.;
-        setFEFM(fe, fm);
+        if (table_ && table_bounds_.contains(std::log10(q2_))) {
+          const auto vals = table_->eval({q2_});
+          setFEFM(vals.at(0), vals.at(1));
+          return;
+        }
+        const auto vals = integrate();
+        setFEFM(vals.at(0), vals.at(1));
       }
 
     private:
+      /// Compute the \f$(F_E,F_M)\f$ form factors at the current \f$Q^2\f$ value from the structure functions
+      GridHandler<1, 2>::values_t integrate() const {
+        const auto inv_q2 = 1. / q2_;
+        return {integr_->integrate(eval_fe_, mx2_range_) * inv_q2,
+                compute_fm_ ? integr_->integrate(eval_fm_, mx2_range_) * inv_q2 : 0.};
+      }
+      /// Build (or retrieve) the \f$Q^2\f$ interpolation table for the form factors
+      void tabulate(const ParametersList& params) {
+        const auto q2_range = params.get<Limits>("Q2range");
+        const auto num_nodes = params.get<int>("numNodes");
+        if (q2_range.min() <= 0. || q2_range.min() >= q2_range.max() || num_nodes < 4)
+          throw CG_FATAL("InelasticNucleon") << "Invalid form factors tabulation range/number of nodes: " << q2_range
+                                             << "/" << num_nodes << ".";
+        table_.reset(new GridHandler<1, 2>(GridType::logarithmic));
+        std::ostringstream os;
+        os << steer<ParametersList>("structureFunctions").serialise() << "|"
+           << steer<ParametersList>("integrator").serialise() << "|" << compute_fm_ << "|" << mx_range_ << "|"
+           << q2_range << "|" << num_nodes;
+        const auto key = std::hash<std::string>()(os.str());
+        const auto q2_prev = q2_;
+        const auto max_error = table_->tabulate(
+            {q2_range.generate(num_nodes, true)},
+            [this](const GridHandler<1, 2>::point_t& point) {
+              q2_ = point[0];
+              return integrate();
+            },
+            params,
+            key);
+        q2_ = q2_prev;
+        table_bounds_ = table_->boundaries().at(0);
+        CG_INFO("InelasticNucleon").log([&](auto& log) {
+          log << "Form factors tabulated with " << utils::s("node", num_nodes, true) << " for Q^2 in range "
+              << q2_range << " GeV^2.";
+          if (max_error)
+            log << " Maximal relative uncertainty from "
+                << utils::s("spot check", params.get<int>("numSpotChecks"), true) << ": " << *max_error << ".";
+          else
+            log << " Table retrieved from '" << params.get<std::string>("gridPath") << "'.";
+        });
+      }
+
       const std::unique_ptr<strfun::Parameterisation> sf_;
       const std::unique_ptr<AnalyticIntegrator> integr_;
       const double compute_fm_;
       const Limits mx_range_, mx2_range_, dm2_range_;
       const std::function<double(double)> eval_fe_, eval_fm_;
+      std::unique_ptr<GridHandler<1, 2> > table_;  ///< Optional form factors interpolation table
+      Limits table_bounds_;                        ///< Table boundaries, in logarithmic coordinates
     };
   }  // namespace formfac
 }  // namespace cepgen
@@ -17,6 +17,7 @@
 #define CepGen_Generator_h
 
 #include <memory>
+#include <mutex>
 
 #include "CepGen/Event/Event.h"
 #include "CepGen/Utils/Value.h"
@@ -123,12 +124,16 @@ namespace cepgen {
     double computePoint(const std::vector<double>& x);
 
   private:
-    void initialise();                           ///< Initialise event generation
+    void initialise();         ///< Initialise event generation
+    void initialiseWorkers();  ///< Prepare the additional workers for a multi-threaded events generation
     std::unique_ptr<RunParameters> parameters_;  ///< Run parameters for event generation and cross-section computation
     std::unique_ptr<GeneratorWorker> worker_;    ///< Generator worker instance
-    std::unique_ptr<Integrator> integrator_;     ///< Integration algorithm
-    bool initialised_{false};                    ///< Has the event generator already been initialised?
-    Value xsect_{-1., -1.};                      ///< Cross section value computed at the last integration
+    /// Additional generator worker instances for a multi-threaded events generation
+    std::vector<std::unique_ptr<GeneratorWorker> > workers_;
+    std::mutex store_mutex_;                  ///< Protection of the events hand-off between concurrent workers
+    std::unique_ptr<Integrator> integrator_;  ///< Integration algorithm
+    bool initialised_{false};                 ///< Has the event generator already been initialised?
+    Value xsect_{-1., -1.};                   ///< Cross section value computed at the last integration
   };
 }  // namespace cepgen
 
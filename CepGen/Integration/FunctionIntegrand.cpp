@@ -23,17 +23,15 @@ namespace cepgen {
   FunctionIntegrand::FunctionIntegrand(size_t ndim, const std::function<double(const std::vector<double>&)>& func)
       : function_(func), ndim_(ndim) {}
 
-  double FunctionIntegrand::eval(const std::vector<double>& x) {
-    if (x.size() != size())
-      throw CG_FATAL("FunctionIntegrand:eval")
-          << "Invalid coordinates multiplicity: expected(" << size() << ") != received(" << x.size() << ")!";
+  double FunctionIntegrand::eval(const double* x) {
+    coords_.assign(x, x + ndim_);  // no reallocation once the buffer is sized
 
     //--- calculate weight for the phase space point to probe
-    double weight = function_(x);
+    double weight = function_(coords_);
 
     //--- a bit of useful debugging
     CG_DEBUG_LOOP("FunctionIntegrand:eval")
-        << "f value for dim-" << x.size() << " point " << x << ": " << weight << ".";
+        << "f value for dim-" << coords_.size() << " point " << coords_ << ": " << weight << ".";
 
     return weight;
   }
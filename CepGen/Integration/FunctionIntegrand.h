@@ -29,12 +29,14 @@ namespace cepgen {
   public:
     explicit FunctionIntegrand(size_t, const std::function<double(const std::vector<double>&)>&);
 
-    double eval(const std::vector<double>&) override;
+    using Integrand::eval;
+    double eval(const double*) override;
     size_t size() const override { return ndim_; }
 
   private:
     std::function<double(const std::vector<double>&)> function_;
     size_t ndim_;
+    std::vector<double> coords_;  ///< Coordinates buffer handed to the function
   };
 }  // namespace cepgen
 
@@ -33,13 +33,11 @@ namespace cepgen {
                                     << "): " << func_->expression() << ".";
   }
 
-  double FunctionalIntegrand::eval(const std::vector<double>& x) {
+  double FunctionalIntegrand::eval(const double* x) {
     if (!func_)
       throw CG_FATAL("FunctionalIntegrand:eval") << "Functional object was not properly initialised!";
-    if (x.size() != size())
-      throw CG_FATAL("FunctionalIntegrand:eval")
-          << "Invalid coordinates multiplicity: expected(" << size() << ") != received(" << x.size() << ")!";
-    return (*func_)(x);
+    coords_.assign(x, x + size());  // no reallocation once the buffer is sized
+    return (*func_)(coords_);
   }
 
   size_t FunctionalIntegrand::size() const {
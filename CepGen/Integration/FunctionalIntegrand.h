@@ -30,11 +30,13 @@ namespace cepgen {
   public:
     explicit FunctionalIntegrand(const std::string&, const std::vector<std::string>&, const std::string& func_eval);
 
-    double eval(const std::vector<double>&) override;
+    using Integrand::eval;
+    double eval(const double*) override;
     size_t size() const override;
 
   private:
     std::unique_ptr<utils::Functional> func_;
+    std::vector<double> coords_;  ///< Coordinates buffer handed to the functional
   };
 }  // namespace cepgen
 
@@ -28,7 +28,7 @@ namespace cepgen {
 
   void GSLIntegrator::setIntegrand(Integrand& integrand) {
     //--- specify the integrand through the GSL wrapper
-    funct_ = [&](double* x, size_t ndim, void*) -> double { return integrand.eval(std::vector<double>(x, x + ndim)); };
+    funct_ = [&](double* x, size_t, void*) -> double { return integrand.eval(x); };
     function_ = utils::GSLMonteFunctionWrapper<decltype(funct_)>::build(funct_, integrand.size());
     if (!function_)
       throw CG_FATAL("GSLIntegrator:setIntegrand") << "Integrand was not properly set.";
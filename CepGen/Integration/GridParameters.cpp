@@ -16,12 +16,15 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <unistd.h>
+
+#include <atomic>
 #include <cmath>  // pow
-#include <functional>
+#include <cstdio>
+#include <fstream>
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Integration/GridParameters.h"
-#include "CepGen/Integration/Integrator.h"
 #include "CepGen/Utils/String.h"
 
 namespace cepgen {
@@ -31,7 +34,7 @@ namespace cepgen {
     for (size_t i = 0; i < (size_t)std::pow(mbin_, ndim_); ++i) {
       generateCoordinates(coord, i);
       coords_.emplace_back(coord);
-      num_points_.emplace_back(0ul);
+      num_points_.emplace_back(0.);
       f_max_.emplace_back(0.);
     }
   }
@@ -42,11 +45,11 @@ namespace cepgen {
     f_max_global_ = std::max(f_max_global_, val);
   }
 
-  void GridParameters::shoot(const Integrator* integr, size_t coord, std::vector<double>& out) const {
-    CG_ASSERT(integr != nullptr);
+  void GridParameters::shoot(const std::function<double()>& rnd, size_t coord, std::vector<double>& out) const {
+    CG_ASSERT(rnd);
     const auto& nv = coords_.at(coord);
     for (size_t i = 0; i < nv.size(); ++i)
-      out[i] = (integr->uniform() + nv.at(i)) * inv_mbin_;
+      out[i] = (rnd() + nv.at(i)) * inv_mbin_;
   }
 
   void GridParameters::dump() const {
@@ -59,6 +62,64 @@ namespace cepgen {
     });
   }
 
+  void GridParameters::save(const std::string& filename, size_t key) const {
+    // write into a unique temporary file, then atomically replace the target, so that concurrent readers
+    // never retrieve a partially written grid
+    static std::atomic<unsigned long> num_saved{0};
+    const auto tmp_filename = utils::format("%s.tmp.%d.%lu", filename.c_str(), (int)::getpid(), num_saved++);
+    {
+      std::ofstream file(tmp_filename, std::ios::binary | std::ios::out | std::ios::trunc);
+      if (!file.is_open())
+        throw CG_ERROR("GridParameters:save") << "Failed to open grid file '" << tmp_filename << "' for writing.";
+      const header_t header{GOOD_MAGIC, VERSION, key, mbin_, ndim_, f_max_global_};
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header_t));
+      file.write(reinterpret_cast<const char*>(f_max_.data()), f_max_.size() * sizeof(float));
+      file.write(reinterpret_cast<const char*>(num_points_.data()), num_points_.size() * sizeof(double));
+      file.close();
+      if (!file.good()) {
+        std::remove(tmp_filename.c_str());
+        throw CG_ERROR("GridParameters:save") << "Failed to write grid file '" << tmp_filename << "'.";
+      }
+    }
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+      std::remove(tmp_filename.c_str());
+      throw CG_ERROR("GridParameters:save") << "Failed to move grid file '" << tmp_filename << "' to '" << filename
+                                            << "'.";
+    }
+    CG_DEBUG("GridParameters:save") << "Grid with " << utils::s("bin", size(), true) << " saved into '" << filename
+                                    << "'.";
+  }
+
+  bool GridParameters::load(const std::string& filename, size_t key) {
+    std::ifstream file(filename, std::ios::binary | std::ios::in);
+    if (!file.is_open())
+      return false;
+    header_t header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header_t)) || header.magic != GOOD_MAGIC ||
+        header.version != VERSION) {
+      CG_WARNING("GridParameters:load") << "Invalid grid file '" << filename << "'.";
+      return false;
+    }
+    if (header.key != key || header.mbin != mbin_ || header.ndim != ndim_) {
+      CG_DEBUG("GridParameters:load") << "Grid file '" << filename << "' does not match the run configuration.";
+      return false;
+    }
+    std::vector<float> f_max(size());
+    std::vector<double> num_points(size());
+    if (!file.read(reinterpret_cast<char*>(f_max.data()), f_max.size() * sizeof(float)) ||
+        !file.read(reinterpret_cast<char*>(num_points.data()), num_points.size() * sizeof(double))) {
+      CG_WARNING("GridParameters:load") << "Truncated grid file '" << filename << "'.";
+      return false;
+    }
+    f_max_ = std::move(f_max);
+    num_points_ = std::move(num_points);
+    f_max_global_ = header.f_max_global;
+    gen_prepared_ = true;
+    CG_DEBUG("GridParameters:load") << "Grid with " << utils::s("bin", size(), true) << " loaded from '" << filename
+                                    << "'.";
+    return true;
+  }
+
   void GridParameters::generateCoordinates(coord_t& coord, size_t i) const {
     size_t jj = i;
     for (size_t j = 0; j < ndim_; ++j) {
@@ -95,7 +156,7 @@ namespace cepgen {
     f_max_old_ = f_max_.at(bin);
     f_max_diff_ = weight - f_max_old_;
     setValue(bin, weight);
-    correc_ = (num_points_.at(bin) - 1) * f_max_diff_ / f_max_global_ - 1.;
+    correc_ = (num_points_.at(bin) - 1.) * f_max_diff_ / f_max_global_ - 1.;
 
     CG_DEBUG("GridParameters:initCorrectionCycle")
         << "Correction " << correc_ << " will be applied "
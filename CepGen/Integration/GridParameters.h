@@ -20,10 +20,11 @@
 #define CepGen_Integration_GridParameters_h
 
 #include <cstddef>
+#include <functional>
+#include <string>
 #include <vector>
 
 namespace cepgen {
-  class Integrator;
   /// A parameters placeholder for the grid integration helper
   class GridParameters {
   public:
@@ -33,6 +34,13 @@ namespace cepgen {
     typedef std::vector<unsigned short> coord_t;  ///< Coordinates definition
 
     void dump() const;  ///< Dump the grid coordinates
+    /// Write the prepared grid into a binary file
+    /// \param[in] key Hash of the run configuration this grid was prepared for
+    void save(const std::string& filename, size_t key) const;
+    /// Retrieve a prepared grid from a binary file
+    /// \param[in] key Hash of the run configuration this grid is expected to be prepared for
+    /// \return True if the grid was successfully retrieved, and matches the run configuration
+    bool load(const std::string& filename, size_t key);
 
     inline size_t size() const { return coords_.size(); }  ///< Grid multiplicity
     /// Number of times a phase space point has been randomly selected
@@ -46,11 +54,15 @@ namespace cepgen {
 
     void setValue(size_t, float);  ///< Set the function value for a given grid coordinate
     /// Shoot a phase space point for a grid coordinate
-    void shoot(const Integrator* integ, size_t coord, std::vector<double>& out) const;
+    /// \param[in] rnd Uniform random number generator in [0, 1)
+    void shoot(const std::function<double()>& rnd, size_t coord, std::vector<double>& out) const;
     /// Number of points already shot for a given grid coordinate
-    inline size_t numPoints(size_t coord) const { return num_points_.at(coord); }
+    /// \note This count may be fractional if the bins are not selected uniformly
+    inline double numPoints(size_t coord) const { return num_points_.at(coord); }
     /// Specify a new trial has been attempted for bin
     inline void increment(size_t coord) { num_points_.at(coord)++; }
+    /// Set the number of trials attempted for a bin (e.g. when bins are not selected uniformly)
+    inline void setNumPoints(size_t coord, double num_points) { num_points_.at(coord) = num_points; }
 
     inline bool prepared() const { return gen_prepared_; }                       ///< Has the grid been prepared
     inline void setPrepared(bool prepared = true) { gen_prepared_ = prepared; }  ///< Mark the grid as prepared
@@ -67,6 +79,17 @@ namespace cepgen {
   private:
     void generateCoordinates(coord_t&, size_t) const;
 
+    static constexpr unsigned int GOOD_MAGIC = 0x43474744;  ///< Magic number for binary grid files
+    static constexpr unsigned short VERSION = 2;            ///< Binary grid file format version
+    /// Binary grid file header
+    struct header_t {
+      unsigned int magic;             ///< File magic number
+      unsigned short version;         ///< File format version
+      unsigned long long key;         ///< Hash of the run configuration the grid was prepared for
+      unsigned long long mbin, ndim;  ///< Grid binning parameters
+      float f_max_global;             ///< Maximal value of the function in the whole grid
+    };
+
     const size_t mbin_;         ///< Integration grid size parameter
     const double inv_mbin_;     ///< Weight of each grid coordinate
     size_t ndim_{0};            ///< Phase space multiplicity
@@ -74,7 +97,7 @@ namespace cepgen {
     float correc_{0.};          ///< Correction to apply on the next phase space point generation
     float correc2_{0.};
     std::vector<coord_t> coords_;     ///< Point coordinates in grid
-    std::vector<size_t> num_points_;  ///< Number of functions values evaluated for this point
+    std::vector<double> num_points_;  ///< Number of functions values evaluated for this point
     std::vector<float> f_max_;        ///< Maximal value of the function at one given point
     float f_max_global_{0.};          ///< Maximal value of the function in the considered integration range
     float f_max2_{0.};
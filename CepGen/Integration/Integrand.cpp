@@ -0,0 +1,35 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Integration/Integrand.h"
+
+namespace cepgen {
+  double Integrand::eval(const std::vector<double>& x) {
+    if (x.size() != size())
+      throw CG_FATAL("Integrand:eval") << "Invalid coordinates multiplicity: expected(" << size() << ") != received("
+                                       << x.size() << ")!";
+    return eval(x.data());
+  }
+
+  void Integrand::evalBatch(const double* x, size_t num_points, double* weights) {
+    const auto ndim = size();
+    for (size_t i = 0; i < num_points; ++i)
+      weights[i] = eval(x + i * ndim);
+  }
+}  // namespace cepgen
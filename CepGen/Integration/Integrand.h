@@ -20,6 +20,7 @@
 #define CepGen_Integration_Integrand_h
 
 #include <cstddef>  // size_t
+#include <memory>
 #include <vector>
 
 namespace cepgen {
@@ -30,9 +31,19 @@ namespace cepgen {
     virtual ~Integrand() {}
 
     /// Compute the integrand for a given coordinates set
-    virtual double eval(const std::vector<double>&) = 0;
+    double eval(const std::vector<double>&);
+    /// Compute the integrand for a given coordinates array
+    /// \param[in] x Array of (at least) size() coordinates, read without copy
+    virtual double eval(const double* x) = 0;
+    /// Compute the integrand for a batch of coordinates sets
+    /// \param[in] x Row-major block of num_points × size() coordinates
+    /// \param[in] num_points Number of phase space points in the batch
+    /// \param[out] weights Array of (at least) num_points integrand values
+    virtual void evalBatch(const double* x, size_t num_points, double* weights);
     /// Phase space dimension
     virtual size_t size() const = 0;
+    /// Independent copy of this integrand, for concurrent evaluations (null if not supported)
+    virtual std::unique_ptr<Integrand> clone() const { return nullptr; }
     /// Does this integrand also contain a process object?
     virtual bool hasProcess() const { return false; }
   };
@@ -16,18 +16,27 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cmath>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/ParametersList.h"
 #include "CepGen/Integration/FunctionIntegrand.h"
 #include "CepGen/Integration/Integrator.h"
 #include "CepGen/Modules/IntegratorFactory.h"
 #include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Utils/String.h"
 
 namespace cepgen {
   Integrator::Integrator(const ParametersList& params)
       : NamedModule(params),
         rnd_gen_(RandomGeneratorFactory::get().build(steer<ParametersList>("randomGenerator"))),
-        verbosity_(steer<int>("verbose")) {}
+        verbosity_(steer<int>("verbose")),
+        target_precision_(steer<double>("targetPrecision")),
+        max_wall_time_(steer<double>("maxWallTime")) {
+    if (target_precision_ < 0.)
+      throw CG_FATAL("Integrator") << "Invalid target relative precision: " << target_precision_ << ".";
+  }
 
   void Integrator::checkLimits(const Integrand& integrand) {
     const auto ps_size = integrand.size();
@@ -53,6 +62,63 @@ namespace cepgen {
 
   double Integrator::uniform(const Limits& lim) const { return rnd_gen_->uniform(lim.min(), lim.max()); }
 
+  unsigned long long Integrator::seed() const { return rnd_gen_->parameters().get<unsigned long long>("seed"); }
+
+  bool Integrator::precisionReached(const Value& estimate) const {
+    if (!precisionDriven() || (double)estimate == 0.)
+      return false;
+    return estimate.uncertainty() <= target_precision_ * std::fabs((double)estimate);
+  }
+
+  bool Integrator::wallTimeExceeded() const { return max_wall_time_ > 0. && timer_.elapsed() > max_wall_time_; }
+
+  size_t Integrator::nextNumCalls(const Value& estimate, size_t num_calls, size_t default_calls) const {
+    const auto min_calls = std::max<size_t>(default_calls / 10, 1), max_calls = 10 * default_calls;
+    auto next_calls = default_calls;
+    if (num_calls > 0 && (double)estimate != 0. && estimate.uncertainty() > 0.) {
+      // the variance scales as 1/N; estimate the total number of calls needed to reach the target precision
+      const auto rel_unc = estimate.uncertainty() / std::fabs((double)estimate);
+      const auto needed_calls = num_calls * std::pow(rel_unc / target_precision_, 2);
+      next_calls = std::clamp<double>(needed_calls - num_calls, min_calls, max_calls);
+    }
+    if (max_wall_time_ > 0. && num_calls > 0) {  // do not plan beyond the remaining wall time
+      const auto elapsed = timer_.elapsed();
+      const auto remaining_calls = std::max(max_wall_time_ - elapsed, 0.) * num_calls / std::max(elapsed, 1.e-6);
+      next_calls = std::max(std::min<size_t>(next_calls, remaining_calls), min_calls);
+    }
+    return next_calls;
+  }
+
+  Value Integrator::integrateRuns(const std::function<Value(size_t)>& run, size_t num_calls) {
+    timer_.reset();
+    if (!precisionDriven())
+      return run(num_calls);
+    // independent estimates are combined with weights proportional to their number of calls
+    double sum_calls = 0., sum_values = 0., sum_variances = 0.;
+    Value result;
+    size_t num_runs = 0;
+    for (auto calls = num_calls;; calls = nextNumCalls(result, (size_t)sum_calls, num_calls)) {
+      const auto estimate = run(calls);
+      sum_calls += calls;
+      sum_values += calls * (double)estimate;
+      sum_variances += std::pow(calls * estimate.uncertainty(), 2);
+      result = Value{sum_values / sum_calls, std::sqrt(sum_variances) / sum_calls};
+      CG_DEBUG("Integrator:integrateRuns") << "Run #" << (++num_runs) << " with " << calls << " calls: " << estimate
+                                           << ", accumulated: " << result << ".";
+      if (precisionReached(result))
+        break;
+      if (wallTimeExceeded()) {
+        CG_WARNING("Integrator:integrateRuns")
+            << "Maximal wall time (" << max_wall_time_ << " s) exceeded before reaching the target precision of "
+            << target_precision_ << ". Relative uncertainty reached: " << result.relativeUncertainty() << ".";
+        break;
+      }
+    }
+    CG_INFO("Integrator:integrateRuns") << "Integration performed in " << utils::s("run", num_runs, true) << " ("
+                                        << (size_t)sum_calls << " function calls, " << timer_.elapsed() << " s).";
+    return result;
+  }
+
   Value Integrator::integrate(Integrand& integrand) {
     if (limits_.size() != integrand.size())
       limits_ = std::vector<Limits>(integrand.size(), Limits{0., 1.});
@@ -78,6 +144,10 @@ namespace cepgen {
     auto desc = ParametersDescription();
     desc.setDescription("Unnamed integrator");
     desc.add<int>("verbose", 1).setDescription("Verbosity level");
+    desc.add<double>("targetPrecision", 0.)
+        .setDescription("target relative precision; if set, the calls budget adapts until it is reached");
+    desc.add<double>("maxWallTime", 0.)
+        .setDescription("maximal wall time (in s) for a precision-driven integration (0 = unbounded)");
     desc.add<ParametersDescription>("randomGenerator", ParametersDescription().setName<std::string>("stl"))
         .setDescription("random number generator engine");
     return desc;
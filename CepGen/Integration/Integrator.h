@@ -19,10 +19,12 @@
 #ifndef CepGen_Integration_Integrator_h
 #define CepGen_Integration_Integrator_h
 
+#include <functional>
 #include <vector>
 
 #include "CepGen/Modules/NamedModule.h"
 #include "CepGen/Utils/RandomGenerator.h"
+#include "CepGen/Utils/Timer.h"
 #include "CepGen/Utils/Value.h"
 
 namespace cepgen {
@@ -44,6 +46,12 @@ namespace cepgen {
     virtual double eval(Integrand&, const std::vector<double>&) const;
     /// Generate a uniformly distributed (between 0 and 1) random number
     virtual double uniform(const Limits& = {0., 1.}) const;
+    /// Seed of the random number generator
+    unsigned long long seed() const;
+    /// Hash of the integrator internal state affecting the function evaluation (e.g. an adapted grid)
+    virtual size_t stateHash() const { return 0; }
+    /// Is the integration steered by a target relative precision rather than a fixed calls budget?
+    bool precisionDriven() const { return target_precision_ > 0.; }
 
     /// Perform the multidimensional Monte Carlo integration
     /// \param[out] result integral computed over the full phase space
@@ -56,9 +64,27 @@ namespace cepgen {
                            const std::vector<Limits>&);
 
   protected:
+    /// Has the target relative precision been reached for this estimate?
+    bool precisionReached(const Value&) const;
+    /// Has the maximal wall time allowed for the integration (counted from the last timer reset) been exceeded?
+    bool wallTimeExceeded() const;
+    /// Number of function calls to be used in the next iteration of a precision-driven integration
+    /// \param[in] estimate current (accumulated) integral estimate
+    /// \param[in] num_calls number of function calls accumulated in this estimate
+    /// \param[in] default_calls nominal number of calls per iteration
+    size_t nextNumCalls(const Value& estimate, size_t num_calls, size_t default_calls) const;
+    /// Perform a single integration with a fixed budget or, for precision-driven integrations,
+    /// repeat independent integrations with adapted budgets until the target precision is met
+    /// \param[in] run integration with a given number of function calls
+    /// \param[in] num_calls nominal number of calls for one integration
+    Value integrateRuns(const std::function<Value(size_t)>& run, size_t num_calls);
+
     const std::unique_ptr<utils::RandomGenerator> rnd_gen_;
-    int verbosity_;               ///< Integrator verbosity
-    std::vector<Limits> limits_;  ///< List of per-variable integration limits
+    int verbosity_;                  ///< Integrator verbosity
+    std::vector<Limits> limits_;     ///< List of per-variable integration limits
+    const double target_precision_;  ///< Target relative precision (0 for fixed-budget integrations)
+    const double max_wall_time_;     ///< Maximal wall time for a precision-driven integration, in s (0 = unbounded)
+    utils::Timer timer_;             ///< Wall time counter for the precision-driven integrations
   };
 }  // namespace cepgen
 
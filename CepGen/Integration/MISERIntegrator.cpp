@@ -63,22 +63,24 @@ namespace cepgen {
                                    << "Dither: " << miser_params_.dither << ".";
 
       // launch the full integration
-      double result, abserr;
-      int res = gsl_monte_miser_integrate(function_.get(),
-                                          &xlow_[0],
-                                          &xhigh_[0],
-                                          function_->dim,
-                                          ncvg_,
-                                          rnd_gen_->engine<gsl_rng>(),
-                                          miser_state.get(),
-                                          &result,
-                                          &abserr);
-
-      if (res != GSL_SUCCESS)
-        throw CG_FATAL("Integrator:integrate") << "Error while performing the integration!\n\t"
-                                               << "GSL error: " << gsl_strerror(res) << ".";
-
-      return Value{result, abserr};
+      return integrateRuns(
+          [this, &miser_state](size_t num_calls) {
+            double result, abserr;
+            if (int res = gsl_monte_miser_integrate(function_.get(),
+                                                    &xlow_[0],
+                                                    &xhigh_[0],
+                                                    function_->dim,
+                                                    num_calls,
+                                                    rnd_gen_->engine<gsl_rng>(),
+                                                    miser_state.get(),
+                                                    &result,
+                                                    &abserr);
+                res != GSL_SUCCESS)
+              throw CG_FATAL("Integrator:integrate") << "Error while performing the integration!\n\t"
+                                                     << "GSL error: " << gsl_strerror(res) << ".";
+            return Value{result, abserr};
+          },
+          ncvg_);
     }
 
   private:
@@ -0,0 +1,517 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <thread>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Integration/Integrand.h"
+#include "CepGen/Integration/NativeVegasIntegrator.h"
+#include "CepGen/Integration/ProcessIntegrand.h"
+#include "CepGen/Modules/IntegratorFactory.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Process/Process.h"
+#include "CepGen/Utils/String.h"
+
+namespace cepgen {
+  NativeVegasIntegrator::NativeVegasIntegrator(const ParametersList& params)
+      : Integrator(params),
+        ncvg_(steer<int>("numFunctionCalls")),
+        iterations_(steer<int>("iterations")),
+        chisq_cut_(steer<double>("chiSqCut")),
+        max_rounds_(steer<int>("maxRounds")),
+        treat_(steer<bool>("treat")),
+        warmup_calls_(steer<int>("warmupCalls")),
+        warmup_iterations_(steer<int>("warmupIterations")),
+        num_increments_(steer<int>("numIncrements")),
+        alpha_(steer<double>("alpha")),
+        beta_(steer<double>("beta")),
+        chunk_size_(steer<int>("chunkSize")),
+        num_threads_(steer<int>("numThreads") > 0 ? steer<int>("numThreads")
+                                                  : std::max(1u, std::thread::hardware_concurrency())),
+        warm_start_(steer<bool>("warmStart")),
+        grid_input_(steer<std::string>("gridInput")),
+        grid_output_(steer<std::string>("gridOutput")),
+        seed_(rnd_gen_->parameters().get<unsigned long long>("seed")) {
+    if (ncvg_ <= 0 || iterations_ <= 0 || max_rounds_ <= 0 || warmup_iterations_ <= 0 || num_increments_ <= 0 ||
+        chunk_size_ <= 0)
+      throw CG_FATAL("NativeVegasIntegrator") << "Invalid integrator parameters: " << params_ << ".";
+    verbosity_ = steer<int>("verbose");  // supersede the parent default verbosity level
+  }
+
+  ParametersDescription NativeVegasIntegrator::description() {
+    auto desc = Integrator::description();
+    desc.setDescription("Native multi-threaded Vegas integrator with adaptive stratified sampling (VEGAS+)");
+    desc.add<int>("numFunctionCalls", 100'000).setDescription("number of function calls per round of iterations");
+    desc.add<int>("iterations", 10).setDescription("number of iterations per round");
+    desc.add<double>("chiSqCut", 1.5);
+    desc.add<int>("maxRounds", 20).setDescription("maximal number of rounds to reach the chi^2 criterion");
+    desc.add<bool>("treat", true).setDescription("Phase space treatment");
+    desc.add<int>("warmupCalls", 25'000).setDescription("number of function calls for the grid warm-up phase");
+    desc.add<int>("warmupIterations", 5).setDescription("number of iterations for the grid warm-up phase");
+    desc.add<int>("numIncrements", 100).setDescription("number of adaptive map increments along each axis");
+    desc.add<double>("alpha", 0.5).setDescription("map adaptation damping exponent (no adaptation if 0)");
+    desc.add<double>("beta", 0.75).setDescription("stratification adaptation damping exponent (uniform if 0)");
+    desc.add<int>("chunkSize", 2'000).setDescription("minimal number of function calls per work unit");
+    desc.add<int>("numThreads", 0).setDescription("number of concurrent threads (all hardware threads if 0)");
+    desc.add<bool>("warmStart", false)
+        .setDescription("re-use the grid adapted in a previous integration as a starting point (e.g. for scans)");
+    desc.add<std::string>("gridInput", "").setDescription("path to a Vegas state to seed the integration with");
+    desc.add<std::string>("gridOutput", "").setDescription("path to a file to dump the adapted Vegas state into");
+    desc.add<int>("verbose", 1);
+    return desc;
+  }
+
+  Value NativeVegasIntegrator::integrate(Integrand& integrand) {
+    timer_.reset();
+    checkLimits(integrand);  // check the integration bounds
+    const auto dim = integrand.size();
+
+    //--- start by preparing the grid/state
+    bool warm_started = false;
+    if (!grid_input_.empty()) {  // seed from an external state
+      State state;
+      if (state.load(grid_input_) && state.dim == dim) {
+        state_ = state;
+        warm_started = true;
+      } else
+        CG_WARNING("NativeVegasIntegrator:integrate")
+            << "Failed to seed the integration from the Vegas state stored in '" << grid_input_
+            << "'. Will start from a uniform grid.";
+    } else if ((warm_start_ || state_seeded_) && state_.dim == dim && !state_.edges.empty()) {
+      CG_INFO("NativeVegasIntegrator:integrate") << "Re-using an already adapted Vegas grid.";
+      warm_started = true;
+    }
+    state_seeded_ = false;
+    if (!warm_started)
+      state_.reset(dim, num_increments_);
+
+    //--- one integrand per thread (the calling thread uses the original one)
+    std::vector<std::unique_ptr<Integrand> > clones;
+    std::vector<Integrand*> integrands{&integrand};
+    for (size_t i = 1; i < num_threads_; ++i) {
+      auto clone = integrand.clone();
+      if (!clone) {
+        CG_INFO("NativeVegasIntegrator:integrate")
+            << "Integrand cannot be cloned for concurrent evaluations. Integration will be single-threaded.";
+        break;
+      }
+      integrands.emplace_back(clone.get());
+      clones.emplace_back(std::move(clone));
+    }
+    CG_DEBUG("NativeVegasIntegrator:integrate")
+        << "Dim-" << dim << " integration prepared with " << utils::s("thread", integrands.size(), true) << ", "
+        << utils::s("increment", state_.num_increments, true) << " per axis.";
+
+    //--- warmup (prepare the grid), unless an adapted grid is already available
+    if (!warm_started && warmup_calls_ > 0) {
+      for (int i = 0; i < warmup_iterations_; ++i)
+        iterate(integrands, warmup_calls_ / warmup_iterations_);
+      CG_INFO("NativeVegasIntegrator:integrate") << "Finished the Vegas warm-up.";
+    }
+
+    //--- integration phase
+    const auto accumulate = [this](double integral, double variance) {
+      // protect the weighted average against (numerically) exact estimates
+      variance = std::max({variance,
+                           std::pow(std::numeric_limits<double>::epsilon() * integral, 2),
+                           std::numeric_limits<double>::min()});
+      const double wgt = 1. / variance;
+      state_.wtd_int_sum += integral * wgt;
+      state_.sum_wgts += wgt;
+      state_.chi_sum += integral * integral * wgt;
+      ++state_.it_num;
+    };
+    const auto chisq_valid = [this]() { return std::fabs(state_.chiSquare() - 1.) <= chisq_cut_ - 1.; };
+    int round = 0;
+    if (precisionDriven()) {  // the budget of each iteration adapts to the observed variance
+      state_.clearAccumulated();
+      const size_t default_calls = ncvg_ / iterations_;
+      size_t num_calls = default_calls, num_accumulated_calls = 0;
+      while (true) {
+        const auto [integral, variance] = iterate(integrands, num_calls);
+        accumulate(integral, variance);
+        num_accumulated_calls += num_calls;
+        const auto result = state_.result();
+        CG_LOG << "\t>> at iteration " << (++round) << " (" << num_calls << " calls): "
+               << utils::format("average = %10.6f   sigma = %10.6f   chi2 = %4.3f.",
+                                (double)result,
+                                result.uncertainty(),
+                                state_.chiSquare());
+        if (state_.it_num > 1 && precisionReached(result) && chisq_valid())
+          break;
+        if (wallTimeExceeded()) {
+          CG_WARNING("NativeVegasIntegrator:integrate")
+              << "Maximal wall time (" << max_wall_time_ << " s) exceeded before reaching the target precision of "
+              << target_precision_ << ". Relative uncertainty reached: " << result.relativeUncertainty() << ".";
+          break;
+        }
+        num_calls = nextNumCalls(result, num_accumulated_calls, default_calls);
+      }
+    } else {
+      do {
+        state_.clearAccumulated();
+        for (int i = 0; i < iterations_; ++i) {
+          const auto [integral, variance] = iterate(integrands, ncvg_ / iterations_);
+          accumulate(integral, variance);
+        }
+        const auto result = state_.result();
+        CG_LOG << "\t>> at call " << (++round) << ": "
+               << utils::format("average = %10.6f   sigma = %10.6f   chi2 = %4.3f.",
+                                (double)result,
+                                result.uncertainty(),
+                                state_.chiSquare());
+      } while (!chisq_valid() && round < max_rounds_);
+      if (!chisq_valid())
+        CG_WARNING("NativeVegasIntegrator:integrate")
+            << "Chi^2 criterion not reached after " << utils::s("round", round, true) << " of iterations.";
+    }
+    if (!grid_output_.empty())
+      state_.save(grid_output_);
+
+    return state_.result();
+  }
+
+  std::pair<double, double> NativeVegasIntegrator::iterate(const std::vector<Integrand*>& integrands,
+                                                           size_t num_calls) {
+    const auto dim = state_.dim, num_incr = state_.num_increments;
+
+    //--- stratification: at least two calls per hypercube
+    auto num_strata = std::max<size_t>(1, std::floor(std::pow(0.5 * num_calls, 1. / dim)));
+    while (num_strata > 1 && std::pow(num_strata, dim) > 0.5 * num_calls)  // protect against rounding
+      --num_strata;
+    size_t num_cubes = 1;
+    for (size_t j = 0; j < dim; ++j)
+      num_cubes *= num_strata;
+    if (num_strata != state_.num_strata || state_.strata_weights.size() != num_cubes) {
+      state_.num_strata = num_strata;
+      state_.strata_weights.assign(num_cubes, 1.);
+    }
+    const double inv_num_strata = 1. / num_strata, cube_volume = 1. / num_cubes;
+    std::vector<size_t> cube_calls(num_cubes, 2);
+    if (const auto sum_weights = std::accumulate(state_.strata_weights.begin(), state_.strata_weights.end(), 0.);
+        num_calls > 2 * num_cubes && sum_weights > 0.)
+      for (size_t h = 0; h < num_cubes; ++h)
+        cube_calls[h] += (num_calls - 2 * num_cubes) * state_.strata_weights[h] / sum_weights;
+
+    //--- split the hypercubes into work units holding a minimal number of calls
+    std::vector<size_t> chunk_begin{0};
+    for (size_t h = 0, chunk_calls = 0; h < num_cubes; ++h)
+      if ((chunk_calls += cube_calls[h]) >= (size_t)chunk_size_ && h + 1 < num_cubes) {
+        chunk_begin.emplace_back(h + 1);
+        chunk_calls = 0;
+      }
+    chunk_begin.emplace_back(num_cubes);
+    const size_t num_chunks = chunk_begin.size() - 1;
+
+    struct ChunkSummary {
+      double integral{0.}, variance{0.};
+      std::vector<double> map_weights;  ///< Squared integrand values accumulated in each map increment
+    };
+    std::vector<ChunkSummary> chunks(num_chunks);
+    std::vector<double> strata_weights(num_cubes, 0.);
+    const auto iteration_id = iteration_id_++;
+    std::atomic<size_t> next_chunk{0};
+
+    auto process_chunks = [&](Integrand& integrand, std::exception_ptr& exc) {
+      try {
+        auto* proc_integrand = integrand.hasProcess() ? dynamic_cast<ProcessIntegrand*>(&integrand) : nullptr;
+        auto proc_rnd_params = proc_integrand
+                                   ? proc_integrand->process().parameters().get<ParametersList>("randomGenerator")
+                                   : ParametersList();
+        std::vector<double> coords, jacobians, weights;
+        std::vector<size_t> increments, cube_index(dim);
+        std::mt19937_64 rng;
+        std::uniform_real_distribution<double> flat;
+        for (size_t ic = next_chunk++; ic < num_chunks; ic = next_chunk++) {
+          std::seed_seq seq{(unsigned int)(seed_ & 0xffffffff),
+                            (unsigned int)(seed_ >> 32),
+                            (unsigned int)(iteration_id & 0xffffffff),
+                            (unsigned int)(iteration_id >> 32),
+                            (unsigned int)ic};
+          rng.seed(seq);
+          if (proc_integrand)  // process-local randomisation also follows the chunk random stream
+            proc_integrand->process().setRandomGenerator(RandomGeneratorFactory::get().build(
+                proc_rnd_params.set<unsigned long long>("seed", rng())));
+          const auto first_cube = chunk_begin[ic], last_cube = chunk_begin[ic + 1];
+          const auto num_points =
+              std::accumulate(cube_calls.begin() + first_cube, cube_calls.begin() + last_cube, (size_t)0);
+          coords.resize(num_points * dim);
+          increments.resize(num_points * dim);
+          jacobians.resize(num_points);
+          weights.resize(num_points);
+          //--- sample all points of the chunk...
+          for (size_t h = first_cube, ip = 0; h < last_cube; ++h) {
+            for (size_t j = 0, rem = h; j < dim; ++j, rem /= num_strata)
+              cube_index[j] = rem % num_strata;
+            for (size_t k = 0; k < cube_calls[h]; ++k, ++ip) {
+              double jacobian = 1.;
+              for (size_t j = 0; j < dim; ++j) {
+                double x;
+                jacobian *= map(j, (cube_index[j] + flat(rng)) * inv_num_strata, x, increments[ip * dim + j]);
+                const auto& lim = limits_.at(j);
+                coords[ip * dim + j] = lim.min() + x * lim.range();
+                jacobian *= lim.range();
+              }
+              jacobians[ip] = jacobian;
+            }
+          }
+          //--- ...evaluate them at once...
+          integrand.evalBatch(coords.data(), num_points, weights.data());
+          //--- ...and collect the per-hypercube and per-increment summaries
+          auto& chunk = chunks[ic];
+          chunk.map_weights.assign(dim * num_incr, 0.);
+          for (size_t h = first_cube, ip = 0; h < last_cube; ++h) {
+            const double num_cube_calls = cube_calls[h];
+            double sum = 0., sum2 = 0.;
+            for (size_t k = 0; k < cube_calls[h]; ++k, ++ip) {
+              const double fj = weights[ip] * jacobians[ip], fj2 = fj * fj;
+              sum += fj;
+              sum2 += fj2;
+              const double map_weight = fj2 * cube_volume / num_cube_calls;
+              for (size_t j = 0; j < dim; ++j)
+                chunk.map_weights[j * num_incr + increments[ip * dim + j]] += map_weight;
+            }
+            const double mean = sum / num_cube_calls, var = std::max(0., sum2 / num_cube_calls - mean * mean);
+            chunk.integral += cube_volume * mean;
+            chunk.variance += cube_volume * cube_volume * var / (num_cube_calls - 1.);
+            strata_weights[h] = std::pow(cube_volume * cube_volume * var, 0.5 * beta_);
+          }
+        }
+      } catch (...) {
+        exc = std::current_exception();
+        next_chunk = num_chunks;  // stop all other threads
+      }
+    };
+
+    //--- dispatch the chunks over all threads (the calling thread handles its share with the original integrand)
+    const auto num_threads = std::min(integrands.size(), num_chunks);
+    std::vector<std::exception_ptr> exceptions(num_threads);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; ++i)
+      threads.emplace_back(process_chunks, std::ref(*integrands.at(i)), std::ref(exceptions.at(i)));
+    process_chunks(*integrands.at(0), exceptions.at(0));
+    for (auto& thread : threads)
+      thread.join();
+    for (const auto& exc : exceptions)
+      if (exc)
+        std::rethrow_exception(exc);
+
+    //--- deterministic (ordered) reduction of all per-chunk quantities
+    double integral = 0., variance = 0.;
+    std::vector<double> map_weights(dim * num_incr, 0.);
+    for (const auto& chunk : chunks) {
+      integral += chunk.integral;
+      variance += chunk.variance;
+      for (size_t i = 0; i < map_weights.size(); ++i)
+        map_weights[i] += chunk.map_weights[i];
+    }
+    CG_DEBUG_LOOP("NativeVegasIntegrator:iterate")
+        << "Iteration #" << iteration_id << " with " << utils::s("hypercube", num_cubes, true) << " in "
+        << utils::s("chunk", num_chunks, true) << ": integral = " << integral << " +/- " << std::sqrt(variance)
+        << ".";
+
+    //--- adapt the stratification and the map for the next iteration
+    state_.strata_weights = std::move(strata_weights);
+    if (alpha_ > 0.)
+      adaptMap(map_weights);
+    return std::make_pair(integral, variance);
+  }
+
+  void NativeVegasIntegrator::adaptMap(const std::vector<double>& map_weights) {
+    const auto num_incr = state_.num_increments;
+    if (num_incr < 2)
+      return;
+    std::vector<double> smoothed(num_incr), new_edges(num_incr + 1);
+    for (size_t j = 0; j < state_.dim; ++j) {
+      const auto* weights = &map_weights[j * num_incr];
+      auto* edges = &state_.edges[j * (num_incr + 1)];
+      //--- smooth the increments weights with their neighbours...
+      smoothed[0] = (7. * weights[0] + weights[1]) / 8.;
+      smoothed[num_incr - 1] = (weights[num_incr - 2] + 7. * weights[num_incr - 1]) / 8.;
+      for (size_t i = 1; i < num_incr - 1; ++i)
+        smoothed[i] = (weights[i - 1] + 6. * weights[i] + weights[i + 1]) / 8.;
+      const auto sum = std::accumulate(smoothed.begin(), smoothed.end(), 0.);
+      if (sum <= 0.)  // no information collected along this axis
+        continue;
+      //--- ...compress their dynamic range...
+      double sum_compressed = 0.;
+      for (auto& weight : smoothed) {
+        weight /= sum;
+        weight = weight <= 0. ? 0. : weight >= 1. ? 1. : std::pow((weight - 1.) / std::log(weight), alpha_);
+        sum_compressed += weight;
+      }
+      //--- ...and redistribute the increments so that each of them holds an equal share of the weights
+      const double share = sum_compressed / num_incr;
+      new_edges[0] = edges[0];
+      new_edges[num_incr] = edges[num_incr];
+      double accumulated = 0.;
+      for (size_t i_new = 1, i_old = 0; i_new < num_incr; ++i_new) {
+        const double target = i_new * share;
+        while (i_old < num_incr - 1 && accumulated + smoothed[i_old] < target)
+          accumulated += smoothed[i_old++];
+        const double frac = smoothed[i_old] > 0. ? std::min(1., (target - accumulated) / smoothed[i_old]) : 0.;
+        new_edges[i_new] = edges[i_old] + frac * (edges[i_old + 1] - edges[i_old]);
+      }
+      std::copy(new_edges.begin(), new_edges.end(), edges);
+    }
+  }
+
+  double NativeVegasIntegrator::map(size_t j, double y, double& x, size_t& increment) const {
+    const auto num_incr = state_.num_increments;
+    const double z = y * num_incr;
+    increment = std::min((size_t)z, num_incr - 1);
+    const auto* edges = &state_.edges[j * (num_incr + 1) + increment];
+    const double width = edges[1] - edges[0];
+    x = edges[0] + width * (z - increment);
+    return num_incr * width;
+  }
+
+  double NativeVegasIntegrator::eval(Integrand& integrand, const std::vector<double>& x) const {
+    //--- by default, no grid treatment
+    if (!treat_ || state_.dim != integrand.size())
+      return integrand.eval(x);
+    //--- treatment of the integration grid
+    // (thread-local buffer, as this method may be called concurrently by several generator workers)
+    thread_local std::vector<double> x_new;
+    x_new.resize(integrand.size());
+    double w = 1.;
+    size_t increment;
+    for (size_t j = 0; j < integrand.size(); ++j)
+      w *= map(j, x.at(j), x_new[j], increment);
+    return w * integrand.eval(x_new);
+  }
+
+  size_t NativeVegasIntegrator::stateHash() const {
+    if (!treat_ || state_.edges.empty())  // no grid treatment, or no grid computed yet
+      return 0;
+    size_t hash = state_.num_increments;
+    for (const auto& edge : state_.edges)
+      hash ^= std::hash<double>()(edge) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+  }
+
+  //-----------------------------------------------------------------------------------------------
+  // adaptive state part
+  //-----------------------------------------------------------------------------------------------
+
+  void NativeVegasIntegrator::State::reset(size_t dimension, size_t increments) {
+    dim = dimension;
+    num_increments = increments;
+    edges.resize(dim * (num_increments + 1));
+    for (size_t j = 0; j < dim; ++j)
+      for (size_t i = 0; i <= num_increments; ++i)
+        edges[j * (num_increments + 1) + i] = (double)i / num_increments;
+    num_strata = 0;
+    strata_weights.clear();
+    clearAccumulated();
+  }
+
+  void NativeVegasIntegrator::State::clearAccumulated() {
+    wtd_int_sum = sum_wgts = chi_sum = 0.;
+    it_num = 0;
+  }
+
+  Value NativeVegasIntegrator::State::result() const {
+    if (sum_wgts <= 0.)
+      return Value{0., 0.};
+    return Value{wtd_int_sum / sum_wgts, std::sqrt(1. / sum_wgts)};
+  }
+
+  double NativeVegasIntegrator::State::chiSquare() const {
+    if (it_num < 2 || sum_wgts <= 0.)
+      return 1.;
+    return std::max(0., chi_sum - wtd_int_sum * wtd_int_sum / sum_wgts) / (it_num - 1.);
+  }
+
+  /// Header of a native Vegas state binary file
+  struct native_vegas_header_t {
+    unsigned int magic;                 ///< File format identifier
+    unsigned short version;             ///< File format version
+    unsigned long long dim;             ///< Number of dimensions
+    unsigned long long num_increments;  ///< Number of map increments per dimension
+    unsigned long long num_strata;      ///< Number of stratification intervals per dimension
+    unsigned long long num_cubes;       ///< Number of stratification hypercubes
+    double wtd_int_sum;                 ///< Weighted sum of the integral estimates
+    double sum_wgts;                    ///< Sum of the weights
+    double chi_sum;                     ///< Sum of the squared integral estimates weights
+    unsigned long long it_num;          ///< Number of iterations accumulated
+  };
+  static constexpr unsigned int NATIVE_VEGAS_MAGIC = 0x4347564e;  ///< "CGVN" in ASCII
+  static constexpr unsigned short NATIVE_VEGAS_VERSION = 1;
+
+  void NativeVegasIntegrator::State::save(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+      throw CG_ERROR("NativeVegasIntegrator:save") << "Failed to open Vegas state file '" << filename
+                                                   << "' for writing.";
+    const native_vegas_header_t header{NATIVE_VEGAS_MAGIC,
+                                       NATIVE_VEGAS_VERSION,
+                                       dim,
+                                       num_increments,
+                                       num_strata,
+                                       strata_weights.size(),
+                                       wtd_int_sum,
+                                       sum_wgts,
+                                       chi_sum,
+                                       it_num};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(native_vegas_header_t));
+    file.write(reinterpret_cast<const char*>(edges.data()), edges.size() * sizeof(double));
+    file.write(reinterpret_cast<const char*>(strata_weights.data()), strata_weights.size() * sizeof(double));
+    CG_INFO("NativeVegasIntegrator:save") << "Vegas state with " << utils::s("increment", num_increments, true)
+                                          << " per dimension saved into '" << filename << "'.";
+  }
+
+  bool NativeVegasIntegrator::State::load(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary | std::ios::in);
+    if (!file.is_open())
+      return false;
+    native_vegas_header_t header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(native_vegas_header_t)) ||
+        header.magic != NATIVE_VEGAS_MAGIC || header.version != NATIVE_VEGAS_VERSION || header.dim < 1 ||
+        header.num_increments < 1) {
+      CG_WARNING("NativeVegasIntegrator:load") << "Invalid Vegas state file '" << filename << "'.";
+      return false;
+    }
+    std::vector<double> file_edges(header.dim * (header.num_increments + 1)), file_weights(header.num_cubes);
+    if (!file.read(reinterpret_cast<char*>(file_edges.data()), file_edges.size() * sizeof(double)) ||
+        !file.read(reinterpret_cast<char*>(file_weights.data()), file_weights.size() * sizeof(double))) {
+      CG_WARNING("NativeVegasIntegrator:load") << "Truncated Vegas state file '" << filename << "'.";
+      return false;
+    }
+    dim = header.dim;
+    num_increments = header.num_increments;
+    edges = std::move(file_edges);
+    num_strata = header.num_strata;
+    strata_weights = std::move(file_weights);
+    wtd_int_sum = header.wtd_int_sum;
+    sum_wgts = header.sum_wgts;
+    chi_sum = header.chi_sum;
+    it_num = header.it_num;
+    CG_INFO("NativeVegasIntegrator:load") << "Vegas state with " << utils::s("increment", num_increments, true)
+                                          << " per dimension loaded from '" << filename << "'.";
+    return true;
+  }
+}  // namespace cepgen
+
+REGISTER_INTEGRATOR("vegas_native", NativeVegasIntegrator);
@@ -0,0 +1,112 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CepGen_Integration_NativeVegasIntegrator_h
+#define CepGen_Integration_NativeVegasIntegrator_h
+
+#include <string>
+#include <vector>
+
+#include "CepGen/Integration/Integrator.h"
+
+namespace cepgen {
+  /// Multi-threaded Vegas integration algorithm with adaptive stratified sampling (VEGAS+), as documented in
+  /// \cite Lepage:1977sw and \cite Lepage:2020tgj
+  /// \note Each iteration is split into chunks of hypercubes, evaluated by a pool of threads each holding its own
+  ///   integrand clone. As every chunk is sampled from its own random stream (seeded from the integrator seed, the
+  ///   iteration, and the chunk index), and all chunks are reduced in order, the result does not depend on the number
+  ///   of threads used.
+  class NativeVegasIntegrator final : public Integrator {
+  public:
+    explicit NativeVegasIntegrator(const ParametersList&);
+
+    static ParametersDescription description();
+
+    Value integrate(Integrand&) override;
+    double eval(Integrand&, const std::vector<double>&) const override;
+    size_t stateHash() const override;
+
+    /// Adaptive map and stratification of the integrator
+    struct State {
+      /// Reset to a uniform map and stratification
+      void reset(size_t dimension, size_t increments);
+      /// Clear the accumulated integral estimates, keeping the adapted map and stratification
+      void clearAccumulated();
+      /// Weighted average of the accumulated integral estimates
+      Value result() const;
+      /// \f$\chi^2\f$ per degree of freedom of the accumulated integral estimates
+      double chiSquare() const;
+      /// Write the state into a binary file
+      void save(const std::string& filename) const;
+      /// Retrieve the state from a binary file
+      /// \return Has the state been successfully retrieved?
+      bool load(const std::string& filename);
+
+      size_t dim{0};                       ///< Integration dimension
+      size_t num_increments{0};            ///< Number of map increments along each axis
+      std::vector<double> edges;           ///< Map increments edges (normalised coordinates), axis after axis
+      size_t num_strata{0};                ///< Number of stratification intervals along each axis
+      std::vector<double> strata_weights;  ///< Damped standard deviations driving the per-hypercube sampling
+      double wtd_int_sum{0.};              ///< Weighted sum of the integral estimates
+      double sum_wgts{0.};                 ///< Sum of the weights
+      double chi_sum{0.};                  ///< Sum of the squared integral estimates weights
+      size_t it_num{0};                    ///< Number of iterations accumulated
+    };
+    const State& state() const { return state_; }  ///< Current adaptive state
+    /// Seed the next integration with an (already adapted) state
+    void setState(const State& state) {
+      state_ = state;
+      state_seeded_ = true;
+    }
+
+  private:
+    /// Perform one iteration with a given number of function calls, and adapt the map and stratification
+    /// \return Integral estimate, and its variance
+    std::pair<double, double> iterate(const std::vector<Integrand*>& integrands, size_t num_calls);
+    /// Adapt the map increments given the accumulated squared integrand values in each increment
+    void adaptMap(const std::vector<double>& map_weights);
+    /// Map a normalised coordinate along one axis
+    /// \param[in] j axis
+    /// \param[in] y normalised coordinate before mapping
+    /// \param[out] x mapped normalised coordinate
+    /// \param[out] increment index of the map increment
+    /// \return Jacobian of the map along this axis
+    double map(size_t j, double y, double& x, size_t& increment) const;
+
+    const int ncvg_;
+    const int iterations_;
+    const double chisq_cut_;
+    const int max_rounds_;
+    const bool treat_;  ///< Is the integrand to be smoothed for events generation?
+    const int warmup_calls_, warmup_iterations_;
+    const int num_increments_;
+    const double alpha_;  ///< Map adaptation damping exponent
+    const double beta_;   ///< Stratification adaptation damping exponent
+    const int chunk_size_;
+    const size_t num_threads_;
+    const bool warm_start_;  ///< Start from the state adapted in the previous integration?
+    const std::string grid_input_, grid_output_;
+    const unsigned long long seed_;  ///< Base seed of all per-chunk random streams
+
+    State state_;
+    bool state_seeded_{false};            ///< Has the state been explicitly seeded for the next integration?
+    unsigned long long iteration_id_{0};  ///< Iterations counter, used to decorrelate the random streams
+  };
+}  // namespace cepgen
+
+#endif
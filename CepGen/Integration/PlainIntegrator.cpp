@@ -40,23 +40,26 @@ namespace cepgen {
       setIntegrand(integrand);
 
       //--- launch integration
-      std::unique_ptr<gsl_monte_plain_state, decltype(&gsl_monte_plain_free)> pln_state(
-          gsl_monte_plain_alloc(function_->dim), gsl_monte_plain_free);
-      double result, abserr;
-      if (int res = gsl_monte_plain_integrate(function_.get(),
-                                              &xlow_[0],
-                                              &xhigh_[0],
-                                              function_->dim,
-                                              ncvg_,
-                                              rnd_gen_->engine<gsl_rng>(),
-                                              pln_state.get(),
-                                              &result,
-                                              &abserr);
-          res != GSL_SUCCESS)
-        throw CG_FATAL("Integrator:integrate") << "Error while performing the integration!\n\t"
-                                               << "GSL error: " << gsl_strerror(res) << ".";
-
-      return Value{result, abserr};
+      return integrateRuns(
+          [this](size_t num_calls) {
+            std::unique_ptr<gsl_monte_plain_state, decltype(&gsl_monte_plain_free)> pln_state(
+                gsl_monte_plain_alloc(function_->dim), gsl_monte_plain_free);
+            double result, abserr;
+            if (int res = gsl_monte_plain_integrate(function_.get(),
+                                                    &xlow_[0],
+                                                    &xhigh_[0],
+                                                    function_->dim,
+                                                    num_calls,
+                                                    rnd_gen_->engine<gsl_rng>(),
+                                                    pln_state.get(),
+                                                    &result,
+                                                    &abserr);
+                res != GSL_SUCCESS)
+              throw CG_FATAL("Integrator:integrate") << "Error while performing the integration!\n\t"
+                                                     << "GSL error: " << gsl_strerror(res) << ".";
+            return Value{result, abserr};
+          },
+          ncvg_);
     }
 
   private:
@@ -24,9 +24,12 @@
 #include "CepGen/EventFilter/EventBrowser.h"
 #include "CepGen/EventFilter/EventModifier.h"
 #include "CepGen/Integration/ProcessIntegrand.h"
+#include "CepGen/Modules/EventModifierFactory.h"
+#include "CepGen/Modules/FunctionalFactory.h"
 #include "CepGen/Process/Process.h"
 #include "CepGen/Utils/Functional.h"
 #include "CepGen/Utils/Math.h"
+#include "CepGen/Utils/String.h"
 #include "CepGen/Utils/TimeKeeper.h"
 
 namespace cepgen {
@@ -34,6 +37,8 @@ namespace cepgen {
     setProcess(proc);
   }
 
+  ProcessIntegrand::~ProcessIntegrand() = default;
+
   ProcessIntegrand::ProcessIntegrand(const RunParameters* params) : params_(params), tmr_(new utils::Timer) {
     if (!params_)
       throw CG_FATAL("ProcessIntegrand") << "Invalid runtime parameters specified.";
@@ -44,6 +49,41 @@ namespace cepgen {
 
   size_t ProcessIntegrand::size() const { return process().ndim(); }
 
+  std::unique_ptr<Integrand> ProcessIntegrand::clone() const {
+    if (!params_->hasProcess())
+      return std::unique_ptr<Integrand>(new ProcessIntegrand(process()));
+    // the copy may be evaluated concurrently to this integrand; it hence holds its own run-level modules
+    std::unique_ptr<ProcessIntegrand> integrand(new ProcessIntegrand(params_));
+    integrand->cloneRunModules(++num_clones_);
+    return integrand;
+  }
+
+  void ProcessIntegrand::cloneRunModules(size_t stream) {
+    taming_functions_.clear();
+    for (const auto& tf : params_->tamingFunctions())
+      taming_functions_.emplace_back(FunctionalFactory::get().build(tf->parameters()));
+    evt_modifiers_.clear();
+    for (const auto& mod : params_->eventModifiersSequence()) {
+      auto local_mod = EventModifierFactory::get().build(mod->parameters());
+      if (const auto seed = mod->parameters().get<int>("seed"); seed >= 0)
+        local_mod->setSeed(seed + stream);
+      else  // engine-default seed for the run-level module; use a distinct seed for each copy
+        local_mod->setSeed(stream);
+      local_mod->initialise(*params_);
+      evt_modifiers_.emplace_back(std::move(local_mod));
+    }
+    taming_vars_.clear();  // re-parsed at the next evaluation
+    local_modules_ = true;
+    CG_DEBUG("ProcessIntegrand:cloneRunModules")
+        << "Integrand-local copies of " << utils::s("taming function", taming_functions_.size(), true) << " and "
+        << utils::s("event modifier", evt_modifiers_.size(), true) << " built for stream " << stream << ".";
+  }
+
+  void ProcessIntegrand::setCrossSection(const Value& cross_section) {
+    for (auto& mod : evt_modifiers_)
+      mod->setCrossSection(cross_section);
+  }
+
   void ProcessIntegrand::setProcess(const proc::Process& proc) {
     //--- each integrand object has its own clone of the process
     process_ = std::move(proc.clone());  // note: kinematics is already set by the process copy constructor
@@ -82,9 +122,19 @@ namespace cepgen {
     return *process_;
   }
 
-  double ProcessIntegrand::eval(const std::vector<double>& x) {
+  double ProcessIntegrand::eval(const double* x) {
     CG_TICKER(const_cast<RunParameters*>(params_)->timeKeeper());
+    return evalPoint(x);
+  }
 
+  void ProcessIntegrand::evalBatch(const double* x, size_t num_points, double* weights) {
+    CG_TICKER(const_cast<RunParameters*>(params_)->timeKeeper());
+    const auto ndim = size();
+    for (size_t i = 0; i < num_points; ++i)
+      weights[i] = evalPoint(x + i * ndim);
+  }
+
+  double ProcessIntegrand::evalPoint(const double* x) {
     //--- start the timer
     tmr_->reset();
     process().clearEvent();
@@ -104,8 +154,14 @@ namespace cepgen {
     auto* event = process_->eventPtr();  // prepare the event content
 
     // once kinematics variables computed, can apply taming functions
-    for (const auto& tam : params_->tamingFunctions())
-      if (const auto val = (*tam)(bws_.get(*event, tam->variables().at(0))) != 0.)
+    const auto& taming_functions = local_modules_ ? taming_functions_ : params_->tamingFunctions();
+    if (taming_vars_.size() != taming_functions.size()) {  // variables are parsed once for all
+      taming_vars_.clear();
+      for (const auto& tam : taming_functions)
+        taming_vars_.emplace_back(bws_.compile(tam->variables().at(0)));
+    }
+    for (size_t i = 0; i < taming_functions.size(); ++i)
+      if (const auto val = (*taming_functions.at(i))(taming_vars_.at(i)(*event)) != 0.)
         weight *= val;
       else
         return 0.;
@@ -116,7 +172,7 @@ namespace cepgen {
     {  // trigger all event modification algorithms
       double br = -1.;
       const auto fast_mode = !storage_;
-      for (auto& mod : params_->eventModifiersSequence()) {
+      for (auto& mod : local_modules_ ? evt_modifiers_ : params_->eventModifiersSequence()) {
         if (!mod->run(*event, br, fast_mode) || br == 0.)
           return 0.;
         weight *= br;  // branching fraction for all decays
@@ -153,7 +209,8 @@ namespace cepgen {
                                         << " ms";
 
       // a bit of debugging information
-      CG_DEBUG_LOOP("ProcessIntegrand") << "f value for dim-" << x.size() << " point " << x << ": " << weight << ".";
+      CG_DEBUG_LOOP("ProcessIntegrand") << "f value for dim-" << size() << " point "
+                                        << std::vector<double>(x, x + size()) << ": " << weight << ".";
     }
     return weight;
   }
@@ -26,11 +26,14 @@
 #include "CepGen/Integration/Integrand.h"
 
 namespace cepgen {
+  class EventModifier;
   class RunParameters;
+  class Value;
   namespace proc {
     class Process;
   }
   namespace utils {
+    class Functional;
     class Timer;
   }
   /// Wrapper to the function to be integrated
@@ -38,6 +41,7 @@ namespace cepgen {
   public:
     explicit ProcessIntegrand(const proc::Process&);
     explicit ProcessIntegrand(const RunParameters*);
+    ~ProcessIntegrand() override;
 
     /// Compute the integrand for a given phase space point (or "event")
     /// \param[in] x Phase space point coordinates
@@ -47,8 +51,12 @@ namespace cepgen {
     ///  \f${\bf x}=\{x_1,\ldots,x_N\}\f$ is therefore an array of random
     ///  numbers defined inside its boundaries (as normalised so that
     ///  \f$\forall i=1,\ldots,N\f$, \f$0<x_i<1\f$).
-    double eval(const std::vector<double>& x) override;
+    double eval(const double* x) override;
+    using Integrand::eval;
+    /// Compute the integrand for a batch of phase space points, with a single bookkeeping for the whole batch
+    void evalBatch(const double* x, size_t num_points, double* weights) override;
     size_t size() const override;  ///< Phase space dimension
+    std::unique_ptr<Integrand> clone() const override;
     bool hasProcess() const override final { return true; }
 
     proc::Process& process();              ///< Thread-local physics process
@@ -57,14 +65,29 @@ namespace cepgen {
     void setStorage(bool store) { storage_ = store; }  ///< Specify if the generated events are to be stored
     bool storage() const { return storage_; }          ///< Are the events currently generated in this run to be stored?
 
+    /// Build integrand-local copies of the run-level taming functions and event modification algorithms
+    /// \note Required for any integrand evaluated concurrently to another one sharing the same run parameters, as
+    ///   these modules are stateful. Without local copies, the run-level modules are used directly.
+    /// \param[in] stream index of this integrand among the concurrent ones, to decorrelate the modifiers seeds
+    void cloneRunModules(size_t stream);
+    /// Feed the process cross section to the integrand-local event modification algorithms (if any)
+    void setCrossSection(const Value&);
+
   private:
     void setProcess(const proc::Process&);
+    double evalPoint(const double*);  ///< Compute the integrand for a single point, without time bookkeeping
 
     std::unique_ptr<proc::Process> process_;   ///< Local instance of the physics process
     const RunParameters* params_{nullptr};     ///< Generator-owned runtime parameters
     const std::unique_ptr<utils::Timer> tmr_;  ///< Timekeeper for event generation
     utils::EventBrowser bws_;                  ///< Event browser
     bool storage_{false};                      ///< Is the next event to be generated to be stored?
+    /// Pre-parsed accessors to the taming functions variables
+    std::vector<utils::EventBrowser::Accessor> taming_vars_;
+    bool local_modules_{false};  ///< Are integrand-local copies of the run-level modules used?
+    std::vector<std::unique_ptr<utils::Functional> > taming_functions_;  ///< Integrand-local taming functions
+    std::vector<std::unique_ptr<EventModifier> > evt_modifiers_;         ///< Integrand-local event modifiers
+    mutable size_t num_clones_{0};  ///< Number of copies built from this integrand
   };
 }  // namespace cepgen
 
@@ -18,6 +18,8 @@
 
 #include <gsl/gsl_monte_vegas.h>
 
+#include <fstream>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Integration/GSLIntegrator.h"
 #include "CepGen/Integration/Integrand.h"
@@ -33,7 +35,12 @@ namespace cepgen {
         : GSLIntegrator(params),
           ncvg_(steer<int>("numFunctionCalls")),
           chisq_cut_(steer<double>("chiSqCut")),
-          treat_(steer<bool>("treat")) {
+          treat_(steer<bool>("treat")),
+          warmup_calls_(steer<int>("warmupCalls")),
+          warm_start_(steer<bool>("warmStart")),
+          keep_accumulated_(steer<bool>("keepAccumulated")),
+          grid_input_(steer<std::string>("gridInput")),
+          grid_output_(steer<std::string>("gridOutput")) {
       verbosity_ = steer<int>("verbose");  // supersede the parent default verbosity level
     }
 
@@ -44,6 +51,13 @@ namespace cepgen {
       desc.add<double>("chiSqCut", 1.5);
       desc.add<bool>("treat", true).setDescription("Phase space treatment");
       desc.add<int>("iterations", 10);
+      desc.add<int>("warmupCalls", 25'000).setDescription("number of function calls for the grid warm-up phase");
+      desc.add<bool>("warmStart", false)
+          .setDescription("re-use the grid adapted in a previous integration as a starting point (e.g. for scans)");
+      desc.add<bool>("keepAccumulated", false)
+          .setDescription("also keep the weighted averages accumulated while adapting the starting grid?");
+      desc.add<std::string>("gridInput", "").setDescription("path to a Vegas state to seed the integration with");
+      desc.add<std::string>("gridOutput", "").setDescription("path to a file to dump the adapted Vegas state into");
       desc.add<double>("alpha", 1.25);
       desc.addAs<int, Mode>("mode", Mode::stratified);
       desc.add<std::string>("loggingOutput", "cerr");
@@ -66,8 +80,24 @@ namespace cepgen {
       return os;
     }
 
+    size_t stateHash() const override {
+      if (!treat_ || !vegas_state_)  // no grid treatment, or no grid computed yet
+        return 0;
+      size_t hash = vegas_state_->bins;
+      for (size_t i = 0; i < (vegas_state_->bins + 1) * vegas_state_->dim; ++i)
+        hash ^= std::hash<double>()(vegas_state_->xi[i]) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+      return hash;
+    }
+
   private:
     void warmup(size_t);
+    /// Prepare the Vegas state, possibly seeded from a previous integration
+    /// \return Has the state been seeded from an already adapted grid?
+    bool prepareState();
+    /// Write the adapted Vegas state into a binary file
+    void saveState(const std::string& filename) const;
+    /// Retrieve an adapted Vegas state from a binary file
+    bool loadState(const std::string& filename);
 
     double COORD(size_t i, size_t j) const { return vegas_state_->xi[i * vegas_state_->dim + j]; }
 
@@ -76,10 +106,9 @@ namespace cepgen {
       if (!treat_)
         return integrand.eval(x);
       //--- treatment of the integration grid
-      if (r_boxes_ == 0) {
-        r_boxes_ = (size_t)std::pow(vegas_state_->bins, integrand.size());
-        x_new_.resize(integrand.size());
-      }
+      // (thread-local buffer, as this method may be called concurrently by several generator workers)
+      thread_local std::vector<double> x_new;
+      x_new.resize(integrand.size());
       double w = r_boxes_;
       for (size_t j = 0; j < integrand.size(); ++j) {
         //--- find surrounding coordinates and interpolate
@@ -88,15 +117,19 @@ namespace cepgen {
         const double rel_pos = z - id;  // position between coordinates (norm.)
         const double bin_width = (id == 0) ? COORD(1, j) : COORD(id + 1, j) - COORD(id, j);
         //--- build new coordinate from linear interpolation
-        x_new_[j] = COORD(id + 1, j) - bin_width * (1. - rel_pos);
+        x_new[j] = COORD(id + 1, j) - bin_width * (1. - rel_pos);
         w *= bin_width;
       }
-      return w * integrand.eval(x_new_);
+      return w * integrand.eval(x_new);
     }
 
     const int ncvg_;
     const double chisq_cut_;
     const bool treat_;  ///< Is the integrand to be smoothed for events generation?
+    const int warmup_calls_;
+    const bool warm_start_;        ///< Start from the grid adapted in the previous integration?
+    const bool keep_accumulated_;  ///< Keep the weighted averages of the seeding grid?
+    const std::string grid_input_, grid_output_;
     gsl_monte_vegas_params vegas_params_;
 
     /// A trivial deleter for the Vegas integrator
@@ -107,20 +140,36 @@ namespace cepgen {
     /// A Vegas integrator state for integration (optional) and/or
     /// "treated" event generation
     std::unique_ptr<gsl_monte_vegas_state, gsl_monte_vegas_deleter> vegas_state_;
-    mutable unsigned long long r_boxes_{0ull};
-    mutable std::vector<double> x_new_;
+    unsigned long long r_boxes_{0ull};
+
+    /// Header of a Vegas state binary file
+    struct header_t {
+      unsigned int magic;       ///< File format identifier
+      unsigned short version;   ///< File format version
+      unsigned long long dim;   ///< Number of dimensions
+      unsigned int bins;        ///< Number of bins per dimension
+      double wtd_int_sum;       ///< Weighted sum of the integral estimates
+      double sum_wgts;          ///< Sum of the weights
+      double chi_sum;           ///< Sum of the squared integral estimates weights
+      unsigned int it_num;      ///< Number of iterations performed
+    };
+    static constexpr unsigned int GOOD_MAGIC = 0x43475653;  ///< "CGVS" in ASCII
+    static constexpr unsigned short VERSION = 1;
   };
 
   Value VegasIntegrator::integrate(Integrand& integrand) {
+    timer_.reset();
     setIntegrand(integrand);
 
     //--- start by preparing the grid/state
-    vegas_state_.reset(gsl_monte_vegas_alloc(function_->dim));
+    const bool warm_started = prepareState();
     gsl_monte_vegas_params_get(vegas_state_.get(), &vegas_params_);
     vegas_params_.iterations = steer<int>("iterations");
     vegas_params_.alpha = steer<double>("alpha");
     vegas_params_.verbose = verbosity_;
     vegas_params_.mode = steer<int>("mode");
+    // stage 0 starts from a uniform grid; stage 1 (2) keeps the grid (and the weighted averages)
+    vegas_params_.stage = warm_started ? (keep_accumulated_ ? 2 : 1) : 0;
     //--- output logging
     const auto& log = steer<std::string>("loggingOutput");
     if (log == "cerr")  // redirect all debugging information to the error stream
@@ -142,18 +191,24 @@ namespace cepgen {
 
     //--- launch integration
 
-    // warmup (prepare the grid)
-    warmup(25'000);
+    // warmup (prepare the grid), unless an adapted grid is already available
+    if (!warm_started && warmup_calls_ > 0)
+      warmup(warmup_calls_);
 
     // integration phase
     unsigned short it_chisq = 0;
     double result, abserr;
-    do {
+    size_t num_calls = 0.2 * ncvg_, num_accumulated_calls = 0;
+    double sum_wgts = 0., wtd_int_sum = 0.;  // combination of the successive (independent) estimates
+    const auto chisq_valid = [this]() {
+      return std::fabs(gsl_monte_vegas_chisq(vegas_state_.get()) - 1.) <= chisq_cut_ - 1.;
+    };
+    while (true) {
       if (int res = gsl_monte_vegas_integrate(function_.get(),
                                               &xlow_[0],
                                               &xhigh_[0],
                                               function_->dim,
-                                              0.2 * ncvg_,
+                                              num_calls,
                                               rnd_gen_->engine<gsl_rng>(),
                                               vegas_state_.get(),
                                               &result,
@@ -169,15 +224,118 @@ namespace cepgen {
                     result,
                     abserr,
                     gsl_monte_vegas_chisq(vegas_state_.get()));
-    } while (std::fabs(gsl_monte_vegas_chisq(vegas_state_.get()) - 1.) > chisq_cut_ - 1.);
+      if (!precisionDriven()) {  // fixed budget per iteration, until the chi^2 criterion is met
+        if (chisq_valid())
+          break;
+        continue;
+      }
+      // precision-driven mode: the budget of the next iteration adapts to the observed variance
+      num_accumulated_calls += num_calls;
+      if (abserr > 0.) {
+        sum_wgts += 1. / (abserr * abserr);
+        wtd_int_sum += result / (abserr * abserr);
+        result = wtd_int_sum / sum_wgts;
+        abserr = 1. / std::sqrt(sum_wgts);
+      }
+      if (precisionReached(Value{result, abserr}) && chisq_valid())
+        break;
+      if (wallTimeExceeded()) {
+        CG_WARNING("VegasIntegrator:integrate")
+            << "Maximal wall time (" << max_wall_time_ << " s) exceeded before reaching the target precision of "
+            << target_precision_ << ". Relative uncertainty reached: " << abserr / std::fabs(result) << ".";
+        break;
+      }
+      num_calls = nextNumCalls(Value{result, abserr}, num_accumulated_calls, 0.2 * ncvg_);
+    }
     CG_DEBUG("Integrator:integrate") << "Vegas grid information:\n\t"
                                      << "ran for " << vegas_state_->dim << " dimensions, "
                                      << "and generated " << vegas_state_->bins_max << " bins.\n\t"
                                      << "Integration volume: " << vegas_state_->vol << ".";
+    r_boxes_ = (unsigned long long)std::pow(vegas_state_->bins, function_->dim);
+    if (!grid_output_.empty())
+      saveState(grid_output_);
 
     return Value{result, abserr};
   }
 
+  bool VegasIntegrator::prepareState() {
+    if (!grid_input_.empty()) {  // seed from an external state
+      vegas_state_.reset(gsl_monte_vegas_alloc(function_->dim));
+      if (loadState(grid_input_))
+        return true;
+      CG_WARNING("VegasIntegrator:prepareState")
+          << "Failed to seed the integration from the Vegas state stored in '" << grid_input_
+          << "'. Will start from a uniform grid.";
+      vegas_state_.reset(gsl_monte_vegas_alloc(function_->dim));
+      return false;
+    }
+    if (warm_start_ && vegas_state_ && vegas_state_->dim == function_->dim && vegas_state_->bins > 1) {
+      // the integration limits may have changed since the previous integration
+      vegas_state_->vol = 1.;
+      for (size_t j = 0; j < function_->dim; ++j)
+        vegas_state_->vol *= (vegas_state_->delx[j] = xhigh_.at(j) - xlow_.at(j));
+      CG_INFO("VegasIntegrator:prepareState") << "Re-using the Vegas grid adapted in the previous integration.";
+      return true;
+    }
+    vegas_state_.reset(gsl_monte_vegas_alloc(function_->dim));
+    return false;
+  }
+
+  void VegasIntegrator::saveState(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+      throw CG_ERROR("VegasIntegrator:saveState") << "Failed to open Vegas state file '" << filename << "' for writing.";
+    const header_t header{GOOD_MAGIC,
+                          VERSION,
+                          vegas_state_->dim,
+                          vegas_state_->bins,
+                          vegas_state_->wtd_int_sum,
+                          vegas_state_->sum_wgts,
+                          vegas_state_->chi_sum,
+                          vegas_state_->it_num};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header_t));
+    file.write(reinterpret_cast<const char*>(vegas_state_->xi),
+               (vegas_state_->bins + 1) * vegas_state_->dim * sizeof(double));
+    CG_INFO("VegasIntegrator:saveState") << "Vegas state with " << utils::s("bin", vegas_state_->bins, true)
+                                         << " per dimension saved into '" << filename << "'.";
+  }
+
+  bool VegasIntegrator::loadState(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary | std::ios::in);
+    if (!file.is_open())
+      return false;
+    header_t header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header_t)) || header.magic != GOOD_MAGIC ||
+        header.version != VERSION) {
+      CG_WARNING("VegasIntegrator:loadState") << "Invalid Vegas state file '" << filename << "'.";
+      return false;
+    }
+    if (header.dim != function_->dim || header.bins < 1 || header.bins > vegas_state_->bins_max) {
+      CG_WARNING("VegasIntegrator:loadState")
+          << "Vegas state stored in '" << filename << "' is incompatible with this integration: "
+          << "dimension=" << header.dim << " (expecting " << function_->dim << "), bins=" << header.bins << ".";
+      return false;
+    }
+    std::vector<double> xi((header.bins + 1) * header.dim);
+    if (!file.read(reinterpret_cast<char*>(xi.data()), xi.size() * sizeof(double))) {
+      CG_WARNING("VegasIntegrator:loadState") << "Truncated Vegas state file '" << filename << "'.";
+      return false;
+    }
+    std::copy(xi.begin(), xi.end(), vegas_state_->xi);
+    vegas_state_->bins = header.bins;
+    vegas_state_->wtd_int_sum = header.wtd_int_sum;
+    vegas_state_->sum_wgts = header.sum_wgts;
+    vegas_state_->chi_sum = header.chi_sum;
+    vegas_state_->it_num = header.it_num;
+    // the grid initialisation is bypassed for an already adapted state; set the integration volume
+    vegas_state_->vol = 1.;
+    for (size_t j = 0; j < function_->dim; ++j)
+      vegas_state_->vol *= (vegas_state_->delx[j] = xhigh_.at(j) - xlow_.at(j));
+    CG_INFO("VegasIntegrator:loadState") << "Vegas state with " << utils::s("bin", header.bins, true)
+                                         << " per dimension loaded from '" << filename << "'.";
+    return true;
+  }
+
   void VegasIntegrator::warmup(size_t ncall) {
     if (!vegas_state_)
       throw CG_FATAL("Integrator:warmup") << "Vegas state not initialised!";
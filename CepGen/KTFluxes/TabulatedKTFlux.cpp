@@ -0,0 +1,124 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <sstream>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/KTFluxes/KTFlux.h"
+#include "CepGen/Modules/PartonFluxFactory.h"
+#include "CepGen/Utils/GridHandler.h"
+#include "CepGen/Utils/String.h"
+
+namespace cepgen {
+  /// Tabulated wrapper around any kT-factorised flux
+  /// \note The flux is sampled once on a \f$(\log x,\log k_{\rm T}^2,\log M_X^2)\f$ grid, and its logarithm is
+  ///   trilinearly interpolated. A single node along the \f$M_X^2\f$ axis (e.g. for elastic fluxes) makes the table
+  ///   independent of the remnant mass. Points outside the tabulated range are forwarded to the wrapped flux.
+  class TabulatedKTFlux final : public KTFlux, private GridHandler<3, 1> {
+  public:
+    explicit TabulatedKTFlux(const ParametersList& params)
+        : KTFlux(params),
+          GridHandler<3, 1>(GridType::logarithmic, /*clamp=*/true),
+          flux_(KTFluxFactory::get().build(steer<ParametersList>("ktFlux"))),
+          ranges_{steer<Limits>("xRange"), steer<Limits>("kt2Range"), steer<Limits>("mx2Range")},
+          num_nodes_(steer<std::vector<int> >("numNodes")) {
+      if (num_nodes_.size() != 3)
+        throw CG_FATAL("TabulatedKTFlux") << "Invalid number of nodes multiplicity: " << num_nodes_ << ".";
+      for (size_t i = 0; i < 3; ++i)
+        if (ranges_.at(i).min() <= 0. || num_nodes_.at(i) < 1 || (num_nodes_.at(i) > 1 && !ranges_.at(i).valid()))
+          throw CG_FATAL("TabulatedKTFlux") << "Invalid tabulation range/number of nodes for axis " << i << ": "
+                                            << ranges_.at(i) << "/" << num_nodes_.at(i) << ".";
+      if (num_nodes_.at(0) < 2 || num_nodes_.at(1) < 2)
+        throw CG_FATAL("TabulatedKTFlux") << "At least two nodes are required along the x and kT^2 axes.";
+      std::array<std::vector<double>, 3> nodes;
+      for (size_t i = 0; i < 3; ++i)
+        nodes[i] = num_nodes_.at(i) > 1 ? ranges_.at(i).generate(num_nodes_.at(i), true)
+                                        : std::vector<double>{ranges_.at(i).min()};
+      const auto max_error = tabulate(
+          nodes,
+          [this](const point_t& point) -> values_t {
+            return {std::log10(std::max(flux_->fluxMX2(point[0], point[1], point[2]), kMinKTFlux))};
+          },
+          params_,
+          configurationHash(),
+          [](double log_flux) {  // compare the flux values themselves, as in interpolate()
+            const auto val = std::pow(10., log_flux);
+            return val > kMinKTFlux ? val : 0.;
+          });
+      bounds_ = boundaries();
+      CG_INFO("TabulatedKTFlux").log([&](auto& log) {
+        log << "kT-factorised flux '" << flux_->name() << "' tabulated on a " << coords_.at(0).size() << "x"
+            << coords_.at(1).size() << "x" << coords_.at(2).size() << " grid.\n\t"
+            << "x in range " << ranges_.at(0) << ", kT^2 in range " << ranges_.at(1) << " GeV^2, mX^2 in range "
+            << ranges_.at(2) << " GeV^2.";
+        if (max_error)
+          log << "\n\tMaximal relative uncertainty from "
+              << utils::s("spot check", steer<int>("numSpotChecks"), true) << ": " << *max_error << ".";
+        else
+          log << "\n\tTable retrieved from '" << steer<std::string>("gridPath") << "'.";
+      });
+    }
+
+    static ParametersDescription description() {
+      auto desc = KTFlux::description();
+      desc.setDescription("Tabulated kT-factorised flux");
+      desc.add<ParametersDescription>("ktFlux", ParametersDescription().setName<std::string>("BudnevInelastic"))
+          .setDescription("kT-factorised flux to tabulate");
+      desc.add<Limits>("xRange", {1.e-5, 1.}).setDescription("tabulated parton momentum fraction range");
+      desc.add<Limits>("kt2Range", {1.e-6, 1.e4})
+          .setDescription("tabulated parton transverse virtuality range (GeV^2)");
+      desc.add<Limits>("mx2Range", {1.16, 1.e4}).setDescription("tabulated remnant squared mass range (GeV^2)");
+      desc.add<std::vector<int> >("numNodes", {50, 50, 50})
+          .setDescription("number of (logarithmic) nodes along the x, kT^2, and mX^2 axes");
+      desc += gridTabulationDescription(100, 1.e-2);
+      return desc;
+    }
+
+    bool fragmenting() const override { return flux_->fragmenting(); }
+    pdgid_t partonPdgId() const override { return flux_->partonPdgId(); }
+    double mass2() const override { return flux_->mass2(); }
+
+    double fluxMX2(double x, double kt2, double mx2) const override {
+      if (!bounds_[0].contains(std::log10(x)) || !bounds_[1].contains(std::log10(kt2)) ||
+          (num_nodes_.at(2) > 1 && !bounds_[2].contains(std::log10(mx2))))
+        return flux_->fluxMX2(x, kt2, mx2);
+      return interpolate(x, kt2, mx2);
+    }
+
+  private:
+    /// Interpolate the flux from the table
+    inline double interpolate(double x, double kt2, double mx2) const {
+      const auto val = std::pow(10., eval({x, kt2, num_nodes_.at(2) > 1 ? mx2 : ranges_.at(2).min()})[0]);
+      return val > kMinKTFlux ? val : 0.;
+    }
+    /// Hash of the configuration the table is built for
+    size_t configurationHash() const {
+      std::ostringstream os;
+      os << steer<ParametersList>("ktFlux").serialise() << "|" << ranges_.at(0) << "|" << ranges_.at(1) << "|"
+         << ranges_.at(2) << "|" << utils::merge(num_nodes_, ",");
+      return std::hash<std::string>()(os.str());
+    }
+
+    const std::unique_ptr<KTFlux> flux_;  ///< Wrapped kT-factorised flux
+    const std::array<Limits, 3> ranges_;  ///< Tabulated (x, kT^2, mX^2) ranges
+    const std::vector<int> num_nodes_;    ///< Number of nodes along each axis
+    std::array<Limits, 3> bounds_;        ///< Grid boundaries, in logarithmic coordinates
+  };
+}  // namespace cepgen
+REGISTER_KT_FLUX("Tabulated", TabulatedKTFlux);
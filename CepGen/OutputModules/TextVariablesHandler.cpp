@@ -41,8 +41,10 @@ namespace cepgen {
       //--- extract list of variables to store in output file
       oss_vars_.clear();
       std::string sep;
-      for (const auto& var : variables_)
+      for (const auto& var : variables_) {
         oss_vars_ << sep << var, sep = separator_;
+        accessors_.emplace_back(browser_.compile(var));
+      }
     }
     ~TextVariablesHandler() {
       file_.close();  // finalisation of the output file
@@ -63,8 +65,8 @@ namespace cepgen {
       if (variables_.empty())
         return true;
       std::string sep;
-      for (const auto& var : variables_)  // write down the variables list in the file
-        file_ << sep << browser_.get(ev, var), sep = separator_;
+      for (const auto& accessor : accessors_)  // write down the variables list in the file
+        file_ << sep << accessor(ev), sep = separator_;
       file_ << "\n";
       return true;
     }
@@ -84,6 +86,7 @@ namespace cepgen {
     const std::string separator_;
 
     const utils::EventBrowser browser_;
+    std::vector<utils::EventBrowser::Accessor> accessors_;  ///< Pre-parsed variables accessors
 
     std::ostringstream oss_vars_;
   };
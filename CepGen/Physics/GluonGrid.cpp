@@ -21,22 +21,32 @@
 
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Physics/GluonGrid.h"
+#include "CepGen/Utils/Filesystem.h"
 #include "CepGen/Utils/Timer.h"
 
 namespace kmr {
   GluonGrid& GluonGrid::get(const cepgen::ParametersList& params) {
+    // grid is built once and only read afterwards, hence it may be shared among all threads
     static GluonGrid instance(!params.empty() ? params : description().parameters());
+    if (params.has<std::string>("path") &&
+        params.get<std::string>("path") != instance.parameters().get<std::string>("path"))
+      CG_WARNING("GluonGrid") << "KMR grid already built from \"" << instance.grid_path_ << "\", requested path \""
+                              << params.get<std::string>("path") << "\" will be ignored.";
     return instance;
   }
 
   GluonGrid::GluonGrid(const cepgen::ParametersList& params)
-      : cepgen::GridHandler<3, 1>(cepgen::GridType::linear /*grid is already logarithmic*/),
+      : cepgen::GridHandler<3, 1>(cepgen::GridType::linear /*grid is already logarithmic*/, /*clamp=*/true),
         SteeredObject(params),
         grid_path_(steerPath("path")) {
     CG_INFO("GluonGrid") << "Building the KMR grid evaluator.";
 
     cepgen::utils::Timer tmr;
-    {  // file readout part
+    if (!cepgen::utils::fileExists(grid_path_))
+      throw CG_FATAL("GluonGrid") << "Failed to load grid file \"" << grid_path_ << "\"!";
+    const auto cache_path = cachePath(grid_path_);
+    const auto cache_key = fileKey(grid_path_);
+    if (!load(cache_path, cache_key)) {  // file readout part
       std::ifstream file(grid_path_, std::ios::in);
       if (!file.is_open())
         throw CG_FATAL("GluonGrid") << "Failed to load grid file \"" << grid_path_ << "\"!";
@@ -46,6 +56,8 @@ namespace kmr {
         insert({std::stod(x), std::stod(kt2), std::stod(mu2)}, {std::stod(fg)});
       file.close();
       initialise();  // initialise the grid after filling its nodes
+      if (save(cache_path, cache_key))
+        CG_DEBUG("GluonGrid") << "KMR grid cached into \"" << cache_path << "\".";
     }
     const auto limits = boundaries();
     CG_INFO("GluonGrid") << "KMR grid evaluator built in " << tmr.elapsed() << " s.\n\t"
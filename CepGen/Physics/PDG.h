@@ -92,7 +92,8 @@ namespace cepgen {
 
   private:
     explicit PDG();
-    /** \note Indexing variable: PDG id of particle */
+    /** \note Indexing variable: PDG id of particle.
+     *  Entries are never removed, so that Particle objects can safely reference their properties. */
     std::unordered_map<pdgid_t, ParticleProperties> particles_;
   };
 }  // namespace cepgen
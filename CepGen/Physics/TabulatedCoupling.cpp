@@ -0,0 +1,143 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <mutex>
+#include <sstream>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Modules/CouplingFactory.h"
+#include "CepGen/Physics/Coupling.h"
+#include "CepGen/Utils/GridHandler.h"
+#include "CepGen/Utils/Message.h"
+#include "CepGen/Utils/String.h"
+
+namespace cepgen {
+  /// Interpolation table for any running coupling evolution algorithm
+  /// \tparam F Factory building the coupling algorithm to tabulate
+  /// \note The wrapped algorithm is only evaluated at construction (or outside the tabulated range if the fallback
+  ///   mode is enabled), so that a non-reentrant coupling evaluator may be used concurrently through this table.
+  ///   When the table is retrieved from its cache file, the wrapped algorithm is not even built.
+  template <typename F>
+  class TabulatedCoupling : public Coupling {
+  public:
+    explicit TabulatedCoupling(const ParametersList& params)
+        : Coupling(params),
+          coupling_params_(steer<ParametersList>("coupling")),
+          q_range_(steer<Limits>("qRange")),
+          num_nodes_(steer<int>("numNodes")),
+          fallback_(steer<bool>("fallback")),
+          grid_(GridType::logarithmic) {
+      if (q_range_.min() <= 0. || q_range_.min() >= q_range_.max() || num_nodes_ < 4)
+        throw CG_FATAL("TabulatedCoupling") << "Invalid coupling tabulation range/number of nodes: " << q_range_
+                                            << "/" << num_nodes_ << ".";
+      std::ostringstream os;
+      os << coupling_params_.serialise() << "|" << q_range_ << "|" << num_nodes_;
+      const auto key = std::hash<std::string>()(os.str());
+      const auto max_error = grid_.tabulate(
+          {q_range_.generate(num_nodes_, true)},
+          [this](const GridHandler<1, 1>::point_t& point) -> GridHandler<1, 1>::values_t {
+            return {wrapped()(point[0])};
+          },
+          params_,
+          key);
+      log_q_range_ = grid_.boundaries().at(0);
+      const auto nodes = grid_.values();  // values at the first and last nodes, to freeze the coupling outside
+      value_min_ = nodes.begin()->second.at(0);
+      value_max_ = nodes.rbegin()->second.at(0);
+      if (!max_error) {
+        CG_INFO("TabulatedCoupling") << "Coupling table for " << coupling_params_.getNameString()
+                                     << " retrieved from '" << steer<std::string>("gridPath") << "'.";
+        return;
+      }
+      CG_INFO("TabulatedCoupling") << "Coupling " << coupling_params_.getNameString() << " tabulated with "
+                                   << utils::s("node", num_nodes_, true) << " for Q in range " << q_range_
+                                   << " GeV. Maximal relative uncertainty from "
+                                   << utils::s("spot check", steer<int>("numSpotChecks"), true) << ": " << *max_error
+                                   << ".";
+    }
+
+    static ParametersDescription description() {
+      auto desc = Coupling::description();
+      desc.add<int>("numNodes", 500).setDescription("number of (logarithmic) nodes along the Q axis");
+      desc += gridTabulationDescription(100, 1.e-4);
+      desc.add<bool>("fallback", false)
+          .setDescription("evaluate the coupling algorithm outside the tabulated range? (frozen at its limits if not)");
+      return desc;
+    }
+
+    double operator()(double q) const override {
+      const auto log_q = std::log10(q);
+      if (log_q < log_q_range_.min())
+        return fallback_ ? wrapped()(q) : value_min_;
+      if (log_q > log_q_range_.max())
+        return fallback_ ? wrapped()(q) : value_max_;
+      return grid_.eval({q}).at(0);
+    }
+
+  private:
+    /// Wrapped coupling evolution algorithm, built once at its first usage (possibly from concurrent threads)
+    const Coupling& wrapped() const {
+      std::call_once(coupling_built_, [this]() { coupling_ = F::get().build(coupling_params_); });
+      return *coupling_;
+    }
+
+    const ParametersList coupling_params_;
+    const Limits q_range_;
+    const int num_nodes_;
+    const bool fallback_;
+    GridHandler<1, 1> grid_;
+    Limits log_q_range_;                          ///< Table boundaries, in logarithmic coordinates
+    double value_min_{0.}, value_max_{0.};        ///< Coupling values at the table boundaries
+    mutable std::unique_ptr<Coupling> coupling_;  ///< Wrapped coupling algorithm
+    mutable std::once_flag coupling_built_;       ///< Has the wrapped coupling algorithm been built?
+  };
+
+  /// Tabulated electromagnetic running coupling
+  class TabulatedAlphaEM final : public TabulatedCoupling<AlphaEMFactory> {
+  public:
+    using TabulatedCoupling::TabulatedCoupling;
+
+    static ParametersDescription description() {
+      auto desc = TabulatedCoupling::description();
+      desc.setDescription("Tabulated alpha(EM) evolution algorithm");
+      desc.add<ParametersDescription>("coupling", ParametersDescription().setName<std::string>("running"))
+          .setDescription("alpha(EM) evolution algorithm to tabulate");
+      desc.add<Limits>("qRange", {1.e-3, 1.e4}).setDescription("tabulated scale range (in GeV)");
+      return desc;
+    }
+  };
+
+  /// Tabulated strong running coupling
+  class TabulatedAlphaS final : public TabulatedCoupling<AlphaSFactory> {
+  public:
+    using TabulatedCoupling::TabulatedCoupling;
+
+    static ParametersDescription description() {
+      auto desc = TabulatedCoupling::description();
+      desc.setDescription("Tabulated alpha(S) evolution algorithm");
+      desc.add<ParametersDescription>("coupling", ParametersDescription().setName<std::string>("pegasus"))
+          .setDescription("alpha(S) evolution algorithm to tabulate");
+      desc.add<Limits>("qRange", {1., 1.e4}).setDescription("tabulated scale range (in GeV)");
+      return desc;
+    }
+  };
+}  // namespace cepgen
+
+REGISTER_ALPHAEM_MODULE("tabulated", TabulatedAlphaEM);
+REGISTER_ALPHAS_MODULE("tabulated", TabulatedAlphaS);
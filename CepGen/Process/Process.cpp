@@ -16,6 +16,7 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <iomanip>
 
 #include "CepGen/Core/Exception.h"
@@ -234,8 +235,8 @@ namespace cepgen {
       return jacobian;
     }
 
-    double Process::weight(const std::vector<double>& x) {
-      point_coord_ = x;
+    double Process::weight(const double* x) {
+      std::copy(x, x + point_coord_.size(), point_coord_.begin());  // coordinates buffer is sized at variables definition
 
       //--- generate and initialise all variables and generate auxiliary
       //    (x-dependent) part of the Jacobian for this phase space point.
@@ -262,6 +263,14 @@ namespace cepgen {
       return (base_jacobian_ * aux_jacobian) * me_integrand * constants::GEVM2_TO_PB;
     }
 
+    std::unique_ptr<utils::RandomGenerator> Process::setRandomGenerator(
+        std::unique_ptr<utils::RandomGenerator> rnd_gen) {
+      if (!rnd_gen)
+        throw CG_FATAL("Process:setRandomGenerator") << "Invalid random number generator engine specified.";
+      std::swap(rnd_gen_, rnd_gen);
+      return rnd_gen;
+    }
+
     void Process::clearEvent() {
       if (event_)
         event_->restore();
@@ -59,7 +59,7 @@ namespace cepgen {
       void setKinematics();
 
       // debugging utilities
-      double weight(const std::vector<double>&);      ///< Compute the weight for a phase-space point
+      double weight(const double*);                   ///< Compute the weight for a phase-space point
       void dumpPoint(std::ostream* = nullptr) const;  ///< Dump the coordinate of the phase-space point being evaluated
       void dumpVariables(std::ostream* = nullptr) const;  ///< List all variables handled by this generic process
 
@@ -96,6 +96,10 @@ namespace cepgen {
 
       double wCM() const { return wcm_; }  ///< Two-parton centre of mass energy
 
+      /// Override the process-local random number generator engine (e.g. for independent streams in threads)
+      /// \return Previous engine, e.g. to be restored afterwards
+      std::unique_ptr<utils::RandomGenerator> setRandomGenerator(std::unique_ptr<utils::RandomGenerator>);
+
     protected:
       static constexpr double NUM_LIMITS = 1.e-3;  ///< Numerical limits for sanity comparisons (MeV/mm-level)
 
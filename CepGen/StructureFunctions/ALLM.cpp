@@ -16,6 +16,7 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <array>
 #include <cassert>
 #include <cmath>
 
@@ -45,9 +46,44 @@ namespace cepgen {
         return desc;
       }
 
-      void eval() override;
+      void eval() override { setF2(computeF2(coeffs_, args_.xbj, args_.q2)); }
+
+    protected:
+      void computeBatch(size_t num_points, const double* xbj, const double* q2, double* f2, double* fl) override {
+        const auto coeffs = coeffs_;  // local copy, so that no coefficient is reloaded within the loop
+        for (size_t i = 0; i < num_points; ++i)
+          f2[i] = computeF2(coeffs, xbj[i], q2[i]);
+        computeBatchFL(num_points, xbj, q2, f2, fl);
+      }
 
     private:
+      /// Flattened set of parameterisation coefficients, with all point-independent terms precomputed
+      struct Coefficients {
+        std::array<double, 3> pom_a, pom_b, pom_c, reg_a, reg_b, reg_c;  ///< Trajectories parameters
+        double m02, mpom2, mreg2, q02, mp2;                               ///< Effective squared masses and scale
+        double inv_lambda2;                                               ///< Inverse squared QCD scale
+        double inv_xlog2;  ///< Inverse of \f$\log(Q_0^2/\Lambda^2)\f$
+      };
+      static inline double computeF2(const Coefficients& cf, double xbj, double q2) {
+        const auto traj1 = [](const std::array<double, 3>& par, double t) {
+          return par[0] + (par[0] - par[1]) * (1. / (1. + std::pow(t, par[2])) - 1.);
+        };
+        const auto traj2 = [](const std::array<double, 3>& par, double t) {
+          return par[0] + par[1] * std::pow(t, par[2]);
+        };
+        const double w2_eff = utils::mX2(xbj, q2, cf.mp2) - cf.mp2;
+        const double xp = (q2 + cf.mpom2) / (q2 + w2_eff + cf.mpom2), xr = (q2 + cf.mreg2) / (q2 + w2_eff + cf.mreg2);
+        const double t = std::log(std::log((q2 + cf.q02) * cf.inv_lambda2) * cf.inv_xlog2);
+
+        const double apom = traj1(cf.pom_a, t), bpom = traj2(cf.pom_b, t), cpom = traj1(cf.pom_c, t);
+        const double areg = traj2(cf.reg_a, t), breg = traj2(cf.reg_b, t), creg = traj2(cf.reg_c, t);
+
+        const double F2_Pom = cpom * std::pow(xp, apom) * std::pow(1. - xbj, bpom),
+                     F2_Reg = creg * std::pow(xr, areg) * std::pow(1. - xbj, breg);
+
+        return q2 / (q2 + cf.m02) * (F2_Pom + F2_Reg);
+      }
+
       class Trajectory : public SteeredObject<Trajectory> {
       public:
         explicit Trajectory(const ParametersList& params)
@@ -80,13 +116,10 @@ namespace cepgen {
                     << "]";
         }
 
-        double eval1(char mod, double t) const {
+        /// Trajectory parameters for a given modulation
+        std::array<double, 3> coefficients(char mod) const {
           const auto& par = get(mod);
-          return par.at(0) + (par.at(0) - par.at(1)) * (1. / (1. + pow(t, par.at(2))) - 1.);
-        }
-        double eval2(char mod, double t) const {
-          const auto& par = get(mod);
-          return par.at(0) + par.at(1) * pow(t, par.at(2));
+          return {par.at(0), par.at(1), par.at(2)};
         }
 
       private:
@@ -114,6 +147,7 @@ namespace cepgen {
       double q02_;
       /// Squared QCD scale
       double lambda2_;
+      Coefficients coeffs_;
     };
 
     ALLM::ALLM(const ParametersList& params)
@@ -124,7 +158,20 @@ namespace cepgen {
           mpom2_(steer<double>("mp2")),
           mreg2_(steer<double>("mr2")),
           q02_(steer<double>("q02")),
-          lambda2_(steer<double>("lambda2")) {
+          lambda2_(steer<double>("lambda2")),
+          coeffs_{pomeron_.coefficients('a'),
+                  pomeron_.coefficients('b'),
+                  pomeron_.coefficients('c'),
+                  reggeon_.coefficients('a'),
+                  reggeon_.coefficients('b'),
+                  reggeon_.coefficients('c'),
+                  m02_,
+                  mpom2_,
+                  mreg2_,
+                  q02_,
+                  mp2_,
+                  1. / lambda2_,
+                  1. / std::log(q02_ / lambda2_)} {
       CG_DEBUG("ALLM") << "ALLM structure functions builder initialised.\n"
                        << " *) Pomeron trajectory: " << pomeron_ << "\n"
                        << " *) Reggeon trajectory: " << reggeon_ << "\n"
@@ -132,23 +179,6 @@ namespace cepgen {
                        << " q_0^2=" << q02_ << ", Lambda^2=" << lambda2_ << " GeV^2.";
     }
 
-    void ALLM::eval() {
-      const double w2_eff = utils::mX2(args_.xbj, args_.q2, mp2_) - mp2_;
-      const double xp = (args_.q2 + mpom2_) / (args_.q2 + w2_eff + mpom2_),
-                   xr = (args_.q2 + mreg2_) / (args_.q2 + w2_eff + mreg2_);
-
-      const double xlog1 = log((args_.q2 + q02_) / lambda2_), xlog2 = log(q02_ / lambda2_);
-      const double t = log(xlog1 / xlog2);
-
-      const double apom = pomeron_.eval1('a', t), bpom = pomeron_.eval2('b', t), cpom = pomeron_.eval1('c', t);
-      const double areg = reggeon_.eval2('a', t), breg = reggeon_.eval2('b', t), creg = reggeon_.eval2('c', t);
-
-      const double F2_Pom = cpom * pow(xp, apom) * pow(1. - args_.xbj, bpom),
-                   F2_Reg = creg * pow(xr, areg) * pow(1. - args_.xbj, breg);
-
-      setF2(args_.q2 / (args_.q2 + m02_) * (F2_Pom + F2_Reg));
-    }
-
     //---------------------------------------------------------------------------------------------
     // ALLM parameterisations
     //---------------------------------------------------------------------------------------------
@@ -42,20 +42,11 @@ namespace cepgen {
           throw CG_FATAL("BlockDurandHa") << "Parameter 'b' should have 3 components! Parsed " << b_ << ".";
         if (c_.size() != 2)
           throw CG_FATAL("BlockDurandHa") << "Parameter 'c' should have 3 components! Parsed " << c_ << ".";
+        coeffs_ = Coefficients{
+            a_[0], a_[1], a_[2], b_[0], b_[1], b_[2], c_[0], c_[1], n_, mu2_, 1. / mu2_, lambda_ * m2_, m2_};
       }
 
-      void eval() override {
-        const double tau = args_.q2 / (args_.q2 + mu2_);
-        const double xl = log1p(args_.q2 / mu2_);
-        const double xlx = log(tau / args_.xbj);
-
-        const double A = a_.at(0) + a_.at(1) * xl + a_.at(2) * xl * xl;
-        const double B = b_.at(0) + b_.at(1) * xl + b_.at(2) * xl * xl;
-        const double C = c_.at(0) + c_.at(1) * xl;
-        const double D = args_.q2 * (args_.q2 + lambda_ * m2_) / pow(args_.q2 + m2_, 2);
-
-        setF2(D * pow(1. - args_.xbj, n_) * (C + A * xlx + B * xlx * xlx));
-      }
+      void eval() override { setF2(computeF2(coeffs_, args_.xbj, args_.q2)); }
 
       static ParametersDescription description() {
         auto desc = Parameterisation::description();
@@ -70,7 +61,34 @@ namespace cepgen {
         return desc;
       }
 
+    protected:
+      void computeBatch(size_t num_points, const double* xbj, const double* q2, double* f2, double* fl) override {
+        const auto coeffs = coeffs_;  // local copy, so that no coefficient is reloaded within the loop
+        for (size_t i = 0; i < num_points; ++i)
+          f2[i] = computeF2(coeffs, xbj[i], q2[i]);
+        computeBatchFL(num_points, xbj, q2, f2, fl);
+      }
+
     private:
+      /// Flattened set of parameterisation coefficients, with all point-independent terms precomputed
+      struct Coefficients {
+        double a0, a1, a2, b0, b1, b2, c0, c1;
+        double n, mu2, inv_mu2, lambda_m2, m2;
+      };
+      static inline double computeF2(const Coefficients& cf, double xbj, double q2) {
+        const double tau = q2 / (q2 + cf.mu2);
+        const double xl = std::log1p(q2 * cf.inv_mu2);
+        const double xlx = std::log(tau / xbj);
+
+        const double A = cf.a0 + xl * (cf.a1 + cf.a2 * xl);
+        const double B = cf.b0 + xl * (cf.b1 + cf.b2 * xl);
+        const double C = cf.c0 + cf.c1 * xl;
+        const double q2_m2 = q2 + cf.m2;
+        const double D = q2 * (q2 + cf.lambda_m2) / (q2_m2 * q2_m2);
+
+        return D * std::pow(1. - xbj, cf.n) * (C + xlx * (A + B * xlx));
+      }
+
       std::vector<double> a_, b_, c_;
       double n_;
       /// Effective mass spread parameter
@@ -79,6 +97,7 @@ namespace cepgen {
       double mu2_;
       /// Squared effective mass (~VM mass)
       double m2_;
+      Coefficients coeffs_;
     };
   }  // namespace strfun
 }  // namespace cepgen
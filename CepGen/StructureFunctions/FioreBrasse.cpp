@@ -16,8 +16,10 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <complex>
+#include <array>
+#include <cmath>
 
+#include "CepGen/Core/Exception.h"
 #include "CepGen/Core/SteeredObject.h"
 #include "CepGen/Modules/StructureFunctionsFactory.h"
 #include "CepGen/Physics/Constants.h"
@@ -35,6 +37,28 @@ namespace cepgen {
           : Parameterisation(params), s0_(steer<double>("s0")), norm_(steer<double>("norm")) {
         for (const auto& res : steer<std::vector<ParametersList> >("resonances"))
           resonances_.emplace_back(res);
+        if (resonances_.size() < 4)
+          throw CG_FATAL("FioreBrasse") << "At least 4 resonances (3 resonant, 1 background) should be provided. "
+                                        << "Parsed " << resonances_.size() << ".";
+        // precompute all point-independent terms of the trajectories
+        const double sqrts0 = std::sqrt(s0_);
+        for (unsigned short i = 0; i < 3; ++i) {  //FIXME 4??
+          const auto& res = resonances_.at(i);
+          coeffs_.res[i] = Trajectory{
+              res.alpha0 + res.alpha2 * sqrts0, res.alpha1, res.alpha2, 1. / res.q02, res.a, res.spinTimesTwo * 0.5};
+        }
+        const auto& bkg = resonances_.at(3);
+        coeffs_.bkg_s = bkg.alpha2;
+        coeffs_.bkg = Trajectory{bkg.alpha0 + bkg.alpha1 * std::sqrt(bkg.alpha2),
+                                 bkg.alpha1,
+                                 0.,
+                                 1. / bkg.q02,
+                                 bkg.a,
+                                 bkg.spinTimesTwo * 0.75};
+        coeffs_.s0 = s0_;
+        coeffs_.sqrts0 = sqrts0;
+        coeffs_.norm = norm_;
+        coeffs_.prefactor = 0.25 * M_1_PI / constants::ALPHA_EM;
       }
 
       static ParametersDescription description() {
@@ -77,9 +101,16 @@ namespace cepgen {
         return desc;
       }
 
-      void eval() override;
+      void eval() override { setF2(computeF2(coeffs_, args_.xbj, args_.q2, mp2_)); }
 
     protected:
+      void computeBatch(size_t num_points, const double* xbj, const double* q2, double* f2, double* fl) override {
+        const auto coeffs = coeffs_;  // local copy, so that no coefficient is reloaded within the loop
+        for (size_t i = 0; i < num_points; ++i)
+          f2[i] = computeF2(coeffs, xbj[i], q2[i], mp2_);
+        computeBatchFL(num_points, xbj, q2, f2, fl);
+      }
+
       /// Description of a single resonance in the modelling
       struct Resonance : SteeredObject<Resonance> {
         explicit Resonance(const ParametersList& params)
@@ -107,53 +138,65 @@ namespace cepgen {
       };
 
     private:
+      /// Point-independent terms of a single Regge trajectory
+      struct Trajectory {
+        double re0;        ///< real part of the trajectory at threshold
+        double alpha1;     ///< slope of the trajectory
+        double alpha2;     ///< threshold term (resonant part only)
+        double inv_q02;    ///< inverse of the form factor scale
+        double a;          ///< weight in the total amplitude
+        double spin_term;  ///< spin-dependent term in the denominator
+        /// Contribution of this trajectory to the total amplitude, given its imaginary part
+        inline double amplitude(double re_alpha, double im_alpha, double q2) const {
+          const double ff_base = 1. + q2 * inv_q02, ff2 = 1. / (ff_base * ff_base * ff_base * ff_base);
+          const double re_diff = spin_term - re_alpha;
+          return a * ff2 * im_alpha / (re_diff * re_diff + im_alpha * im_alpha);
+        }
+      };
+      /// Flattened set of parameterisation coefficients, with all point-independent terms precomputed
+      struct Coefficients {
+        std::array<Trajectory, 3> res;
+        Trajectory bkg;
+        double bkg_s, s0, sqrts0, norm, prefactor;
+      };
+      static double computeF2(const Coefficients& cf, double xbj, double q2, double mp2);
+
       /// All resonances considered in this modelling
       std::vector<Resonance> resonances_;
       double s0_{0.}, norm_{0.};
+      Coefficients coeffs_;
     };
 
-    void FioreBrasse::eval() {
-      const double prefactor =
-          args_.q2 * (1. - args_.xbj) / (4. * M_PI * constants::ALPHA_EM * gamma2(args_.xbj, args_.q2));
-      const double s = utils::mX2(args_.xbj, args_.q2, mp2_);
+    double FioreBrasse::computeF2(const Coefficients& cf, double xbj, double q2, double mp2) {
+      const double gamma2 = 1. + 4. * xbj * xbj * mp2 / q2;
+      const double prefactor = q2 * (1. - xbj) * cf.prefactor / gamma2;
+      const double s = utils::mX2(xbj, q2, mp2);
 
       double amplitude_res = 0.;
-      const double sqrts0 = sqrt(s0_);
-      for (unsigned short i = 0; i < 3; ++i) {  //FIXME 4??
-        const auto& res = resonances_.at(i);
-
-        std::complex<double> alpha;
-        if (s > s0_)
-          alpha = std::complex<double>(res.alpha0 + res.alpha2 * sqrts0 + res.alpha1 * s, res.alpha2 * sqrt(s - s0_));
+      const double sqrt_ds0 = std::sqrt(std::fabs(s - cf.s0));
+      for (const auto& res : cf.res) {
+        if (s > cf.s0)
+          amplitude_res += res.amplitude(res.re0 + res.alpha1 * s, res.alpha2 * sqrt_ds0, q2);
         else
-          alpha = std::complex<double>(res.alpha0 + res.alpha1 * s + res.alpha2 * (sqrts0 - sqrt(s0_ - s)), 0.);
-
-        double formfactor = 1. / pow(1. + args_.q2 / res.q02, 2);
-        double denom = pow(res.spinTimesTwo * 0.5 - std::real(alpha), 2) + pow(std::imag(alpha), 2);
-        double ampli_imag = res.a * formfactor * formfactor * std::imag(alpha) / denom;
-        amplitude_res += ampli_imag;
+          amplitude_res += res.amplitude(res.re0 + res.alpha1 * s - res.alpha2 * sqrt_ds0, 0., q2);
       }
       double amplitude_bg = 0.;
       {
-        const auto& res = resonances_.at(3);
-        double sE = res.alpha2, sqrtsE = sqrt(sE);
-        std::complex<double> alpha;
-        if (s > sE)
-          alpha = std::complex<double>(res.alpha0 + res.alpha1 * sqrtsE, res.alpha1 * sqrt(s - sE));
+        const auto& bkg = cf.bkg;
+        const double sqrt_dse = std::sqrt(std::fabs(s - cf.bkg_s));
+        if (s > cf.bkg_s)
+          amplitude_bg = bkg.amplitude(bkg.re0, bkg.alpha1 * sqrt_dse, q2);
         else
-          alpha = std::complex<double>(res.alpha0 + res.alpha1 * (sqrtsE - sqrt(sE - s)), 0.);
-        double formfactor = 1. / pow(1. + args_.q2 / res.q02, 2);
-        double denom = pow(res.spinTimesTwo * 0.75 - std::real(alpha), 2) + pow(std::imag(alpha), 2);
-        amplitude_bg = res.a * formfactor * formfactor * std::imag(alpha) / denom;
+          amplitude_bg = bkg.amplitude(bkg.re0 - bkg.alpha1 * sqrt_dse, 0., q2);
       }
-      const double amplitude_tot = norm_ * (amplitude_res + amplitude_bg);
+      const double amplitude_tot = cf.norm * (amplitude_res + amplitude_bg);
 
       CG_DEBUG_LOOP("FioreBrasse:amplitudes") << "Amplitudes:\n\t"
                                               << " resonance part:  " << amplitude_res << ",\n\t"
                                               << " background part: " << amplitude_bg << ",\n\t"
                                               << " total (with norm.): " << amplitude_tot << ".";
 
-      setF2(prefactor * amplitude_tot);
+      return prefactor * amplitude_tot;
     }
 
     class FioreBrasseAlt final : public FioreBrasse {
@@ -33,6 +33,7 @@
 #include "CepGen/Utils/Derivator.h"
 #include "CepGen/Utils/Filesystem.h"
 #include "CepGen/Utils/GridHandler.h"
+#include "CepGen/Utils/String.h"
 
 namespace cepgen {
   namespace strfun {
@@ -198,6 +199,15 @@ namespace cepgen {
         if (!utils::fileExists(sfs_grid_file_))
           throw CG_FATAL("KulaginBarinov")
               << "Failed to load the DIS structure functions interpolation grid from '" << sfs_grid_file_ << "'!";
+        // grid nodes depend on the Q^2 range covered by the grid
+        const auto range_key =
+            std::hash<std::string>()(utils::format("%g:%g", q2_grid_range_.min(), q2_grid_range_.max()));
+        const auto cache_path = sfs_grid_.cachePath(sfs_grid_file_, range_key);
+        const auto cache_key = sfs_grid_.fileKey(sfs_grid_file_, range_key);
+        if (sfs_grid_.load(cache_path, cache_key)) {
+          CG_INFO("KulaginBarinov") << "A08 structure function values retrieved from '" << cache_path << "' cache.";
+          return;
+        }
         CG_INFO("KulaginBarinov") << "Loading A08 structure function values from '" << sfs_grid_file_ << "' file.";
         std::ifstream grid_file(sfs_grid_file_);
         static const size_t num_xbj = 99, num_q2 = 70, num_sf = 2;
@@ -232,6 +242,7 @@ namespace cepgen {
         }
         sfs_grid_.initialise();
         CG_DEBUG("KulaginBarinov:grid") << "Grid boundaries: " << sfs_grid_.boundaries();
+        sfs_grid_.save(cache_path, cache_key);
       }
     }
 
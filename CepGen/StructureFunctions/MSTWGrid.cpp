@@ -51,13 +51,18 @@ namespace mstw {
         if (header_.nucleon != header_t::proton)
           throw CG_FATAL("MSTW") << "Only proton structure function grids can be retrieved for this purpose!";
 
-        // retrieve all points and evaluate grid boundaries
-
-        sfval_t val{};
-        while (file.read(reinterpret_cast<char*>(&val), sizeof(sfval_t)))
-          insert({val.xbj, val.q2}, {val.f2, val.fl});
-        file.close();
-        initialise();  // initialise the grid after filling its nodes
+        // retrieve all points and evaluate grid boundaries (or retrieve them from the binary cache)
+
+        const auto cache_path = cachePath(grid_path);
+        const auto cache_key = fileKey(grid_path);
+        if (!load(cache_path, cache_key)) {
+          sfval_t val{};
+          while (file.read(reinterpret_cast<char*>(&val), sizeof(sfval_t)))
+            insert({val.xbj, val.q2}, {val.f2, val.fl});
+          file.close();
+          initialise();  // initialise the grid after filling its nodes
+          save(cache_path, cache_key);
+        }
       }
       const auto& bounds = boundaries();
       CG_DEBUG("MSTW") << "MSTW@" << header_.order << " grid evaluator built "
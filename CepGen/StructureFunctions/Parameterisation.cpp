@@ -16,11 +16,17 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cmath>
+#include <sstream>
+#include <vector>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/ParametersList.h"
 #include "CepGen/Modules/StructureFunctionsFactory.h"
 #include "CepGen/Physics/PDG.h"
 #include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/GridHandler.h"
+#include "CepGen/Utils/String.h"
 
 namespace cepgen {
   namespace strfun {
@@ -32,8 +38,12 @@ namespace cepgen {
           mx_min_(mp_ + PDG::get().mass(PDG::piZero)) {
       CG_DEBUG("Parameterisation") << "Structure functions parameterisation to be built using following parameters:\n"
                                    << ParametersDescription(params_).describe(true);
+      if (const auto& tab_params = steer<ParametersList>("sigmaRatioTable"); tab_params.get<bool>("enabled"))
+        tabulateSigmaRatio(tab_params);
     }
 
+    Parameterisation::~Parameterisation() = default;
+
     Parameterisation& Parameterisation::operator()(double xbj, double q2) {
       const auto args = Arguments{xbj, q2};
       if (args == args_)
@@ -45,6 +55,7 @@ namespace cepgen {
       }
       args_ = args;
       eval();
+      computeFL(xbj, q2);  // FL derived from F2 and the R ratio in the same pass, unless already set by the modelling
       return *this;
     }
 
@@ -56,11 +67,7 @@ namespace cepgen {
 
     double Parameterisation::F2(double xbj, double q2) { return operator()(xbj, q2).vals_.f2; }
 
-    double Parameterisation::FL(double xbj, double q2) {
-      if (!fl_computed_)
-        computeFL(xbj, q2);
-      return operator()(xbj, q2).vals_.fl;
-    }
+    double Parameterisation::FL(double xbj, double q2) { return operator()(xbj, q2).vals_.fl; }
 
     double Parameterisation::W1(double xbj, double q2) { return operator()(xbj, q2).vals_.w1; }
 
@@ -74,6 +81,119 @@ namespace cepgen {
       return 0.5 * (gamma2(xbj, q2) * F2(xbj, q2) - FL(xbj, q2)) / xbj;
     }
 
+    void Parameterisation::evalBatch(
+        size_t num_points, const double* xbj, const double* q2, double* f2, double* fl) {
+      auto& valid_ids = batch_ids_;  // scratch buffers are kept across calls to avoid any reallocation
+      valid_ids.clear();
+      for (size_t i = 0; i < num_points; ++i)
+        if (Arguments{xbj[i], q2[i]}.valid())
+          valid_ids.emplace_back(i);
+      if (valid_ids.size() == num_points) {  // fast path: batch can be evaluated in place
+        computeBatch(num_points, xbj, q2, f2, fl);
+        return;
+      }
+      CG_WARNING("StructureFunctions") << "Invalid range for Q² or xBj in " << num_points - valid_ids.size()
+                                       << " out of " << num_points << " couple(s) of the batch.";
+      for (size_t i = 0; i < num_points; ++i) {
+        f2[i] = 0.;
+        if (fl)
+          fl[i] = 0.;
+      }
+      if (valid_ids.empty())
+        return;
+      // gather the valid couples, evaluate them, and scatter the results back
+      const auto num_valid = valid_ids.size();
+      if (batch_buffer_.size() < 4 * num_valid)
+        batch_buffer_.resize(4 * num_valid);
+      auto *valid_xbj = batch_buffer_.data(), *valid_q2 = valid_xbj + num_valid, *valid_f2 = valid_q2 + num_valid,
+           *valid_fl = valid_f2 + num_valid;
+      for (size_t j = 0; j < num_valid; ++j) {
+        valid_xbj[j] = xbj[valid_ids[j]];
+        valid_q2[j] = q2[valid_ids[j]];
+      }
+      computeBatch(num_valid, valid_xbj, valid_q2, valid_f2, fl ? valid_fl : nullptr);
+      for (size_t j = 0; j < num_valid; ++j) {
+        f2[valid_ids[j]] = valid_f2[j];
+        if (fl)
+          fl[valid_ids[j]] = valid_fl[j];
+      }
+    }
+
+    void Parameterisation::evalBatch(const std::vector<double>& xbj,
+                                     const std::vector<double>& q2,
+                                     std::vector<double>& f2,
+                                     std::vector<double>& fl) {
+      if (xbj.size() != q2.size())
+        throw CG_FATAL("StructureFunctions:evalBatch")
+            << "Inconsistent batch sizes for xBj (" << xbj.size() << ") and Q² (" << q2.size() << ").";
+      f2.resize(xbj.size());
+      fl.resize(xbj.size());
+      evalBatch(xbj.size(), xbj.data(), q2.data(), f2.data(), fl.data());
+    }
+
+    void Parameterisation::computeBatch(
+        size_t num_points, const double* xbj, const double* q2, double* f2, double* fl) {
+      for (size_t i = 0; i < num_points; ++i) {
+        f2[i] = F2(xbj[i], q2[i]);  // F2 first, as FL may be derived from it
+        if (fl)
+          fl[i] = FL(xbj[i], q2[i]);
+      }
+    }
+
+    void Parameterisation::computeBatchFL(
+        size_t num_points, const double* xbj, const double* q2, const double* f2, double* fl) const {
+      if (!fl)
+        return;
+      if (!r_ratio_)
+        throw CG_FATAL("StructureFunctions:FL") << "Failed to retrieve a R-ratio calculator!";
+      for (size_t i = 0; i < num_points; ++i) {
+        const auto r = sigmaRatio(xbj[i], q2[i]);
+        fl[i] = f2[i] * gamma2(xbj[i], q2[i]) * (r / (1. + r));
+      }
+    }
+
+    double Parameterisation::sigmaRatio(double xbj, double q2) const {
+      if (r_table_ && r_table_bounds_[0].contains(std::log10(xbj)) && r_table_bounds_[1].contains(std::log10(q2)))
+        return r_table_->eval({xbj, q2}).at(0);
+      double r_error;
+      return (*r_ratio_)(xbj, q2, r_error);
+    }
+
+    void Parameterisation::tabulateSigmaRatio(const ParametersList& params) {
+      if (!r_ratio_)
+        throw CG_FATAL("StructureFunctions:tabulate") << "Failed to retrieve a R-ratio calculator to tabulate!";
+      const auto xbj_range = params.get<Limits>("xBjRange"), q2_range = params.get<Limits>("Q2range");
+      const auto num_nodes = params.get<std::vector<int> >("numNodes");
+      if (xbj_range.min() <= 0. || xbj_range.max() >= 1. || xbj_range.min() >= xbj_range.max() ||
+          q2_range.min() <= 0. || q2_range.min() >= q2_range.max() || num_nodes.size() != 2 || num_nodes.at(0) < 2 ||
+          num_nodes.at(1) < 2)
+        throw CG_FATAL("StructureFunctions:tabulate")
+            << "Invalid R ratio tabulation ranges/number of nodes: xBj: " << xbj_range << ", Q^2: " << q2_range
+            << ", nodes: " << utils::merge(num_nodes, ",") << ".";
+      r_table_.reset(new GridHandler<2, 1>(GridType::logarithmic));
+      std::ostringstream os;
+      os << r_ratio_->parameters().serialise() << "|" << xbj_range << "|" << q2_range << "|"
+         << utils::merge(num_nodes, ",");
+      const auto max_error = r_table_->tabulate(
+          {xbj_range.generate(num_nodes.at(0), true), q2_range.generate(num_nodes.at(1), true)},
+          [this](const GridHandler<2, 1>::point_t& point) -> GridHandler<2, 1>::values_t {
+            double r_error;
+            return {(*r_ratio_)(point[0], point[1], r_error)};
+          },
+          params,
+          std::hash<std::string>()(os.str()));
+      r_table_bounds_ = r_table_->boundaries();
+      CG_INFO("StructureFunctions:tabulate").log([&](auto& log) {
+        log << "R ratio tabulated with " << num_nodes.at(0) << "x" << num_nodes.at(1) << " nodes for xBj in range "
+            << xbj_range << " and Q^2 in range " << q2_range << " GeV^2.";
+        if (max_error)
+          log << " Maximal relative uncertainty from "
+              << utils::s("spot check", params.get<int>("numSpotChecks"), true) << ": " << *max_error << ".";
+        else
+          log << " Table retrieved from '" << params.get<std::string>("gridPath") << "'.";
+      });
+    }
+
     Parameterisation& Parameterisation::setF1F2(double f1, double f2) {
       return (*this)
           .setF2(f2)  // trivial
@@ -116,10 +236,11 @@ namespace cepgen {
     double Parameterisation::gamma2(double xbj, double q2) const { return 1. + tau(xbj, q2); }
 
     Parameterisation& Parameterisation::computeFL(double xbj, double q2) {
-      if (!fl_computed_ && !r_ratio_)
+      if (fl_computed_)
+        return *this;
+      if (!r_ratio_)
         throw CG_FATAL("StructureFunctions:FL") << "Failed to retrieve a R-ratio calculator!";
-      double r_error;
-      return computeFL(xbj, q2, (*r_ratio_)(xbj, q2, r_error));
+      return computeFL(xbj, q2, sigmaRatio(xbj, q2));
     }
 
     Parameterisation& Parameterisation::computeFL(double xbj, double q2, double r) {
@@ -148,6 +269,15 @@ namespace cepgen {
       desc.setDescription("Unnamed structure functions parameterisation");
       desc.add<int>("sigmaRatio", 4 /* SibirtsevBlunden */)
           .setDescription("Modelling for the sigma(L/T) ratio used in FL computation from F2");
+      auto tab_desc = ParametersDescription();
+      tab_desc.add<bool>("enabled", false).setDescription("serve the sigma(L/T) ratio from a precomputed table?");
+      tab_desc.add<Limits>("xBjRange", {1.e-6, 0.999}).setDescription("tabulated Bjorken-x range");
+      tab_desc.add<Limits>("Q2range", {1.e-4, 1.e4}).setDescription("tabulated virtuality range (in GeV^2)");
+      tab_desc.add<std::vector<int> >("numNodes", {100, 100})
+          .setDescription("number of (logarithmic) nodes along the xBj and Q^2 axes");
+      tab_desc += gridTabulationDescription(100, 1.e-2);
+      desc.add<ParametersDescription>("sigmaRatioTable", tab_desc)
+          .setDescription("interpolation table for the sigma(L/T) ratio (evaluated once at initialisation)");
       return desc;
     }
   }  // namespace strfun
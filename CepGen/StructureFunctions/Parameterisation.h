@@ -19,13 +19,18 @@
 #ifndef CepGen_StructureFunctions_Parameterisation_h
 #define CepGen_StructureFunctions_Parameterisation_h
 
+#include <array>
 #include <iosfwd>
 #include <memory>
+#include <vector>
 
 #include "CepGen/Modules/NamedModule.h"
 #include "CepGen/StructureFunctions/SigmaRatio.h"
+#include "CepGen/Utils/Limits.h"
 
 namespace cepgen {
+  template <size_t D, size_t N>
+  class GridHandler;
   /// Structure functions modelling scope
   namespace strfun {
     /// Base object for the parameterisation of nucleon structure functions
@@ -33,7 +38,7 @@ namespace cepgen {
     public:
       /// User-steered parameterisation object constructor
       explicit Parameterisation(const ParametersList&);
-      virtual ~Parameterisation() = default;
+      virtual ~Parameterisation();
 
       /// Generic description for the structure functions
       static ParametersDescription description();
@@ -62,6 +67,20 @@ namespace cepgen {
       /// \f$F_1\f$ structure function
       double F1(double xbj, double q2);
 
+      /// Compute the \f$F_2\f$ and \f$F_L\f$ structure functions for a batch of \f$(x_{\rm Bj},Q^2)\f$ couples
+      /// \param[in] num_points Number of couples to evaluate
+      /// \param[in] xbj Bjorken's x values
+      /// \param[in] q2 Squared 4-momentum transfers (in GeV^2)
+      /// \param[out] f2 Transverse structure function values
+      /// \param[out] fl Longitudinal structure function values (not computed if null)
+      /// \note Invalid couples are attributed null structure functions values
+      void evalBatch(size_t num_points, const double* xbj, const double* q2, double* f2, double* fl = nullptr);
+      /// Compute the \f$F_2\f$ and \f$F_L\f$ structure functions for a collection of \f$(x_{\rm Bj},Q^2)\f$ couples
+      void evalBatch(const std::vector<double>& xbj,
+                     const std::vector<double>& q2,
+                     std::vector<double>& f2,
+                     std::vector<double>& fl);
+
       struct Arguments {
         bool operator==(const Arguments& oth) const { return xbj == oth.xbj && q2 == oth.q2; }
         bool valid() const { return q2 >= 0. && xbj >= 0. && xbj < 1.; }
@@ -87,6 +106,15 @@ namespace cepgen {
       virtual Parameterisation& computeFL(double xbj, double q2);
       /// Compute the longitudinal structure function for a given point
       virtual Parameterisation& computeFL(double xbj, double q2, double r);
+      /// Batch structure functions evaluation method, only called for valid couples
+      /// \note Invalid couples are filtered out of the batch by evalBatch() prior to this call
+      /// \note The default implementation sequentially calls the single-point evaluation. Closed-form parameterisations
+      ///   may override it with a state-less loop over the couples, which the compiler may vectorise.
+      virtual void computeBatch(size_t num_points, const double* xbj, const double* q2, double* f2, double* fl);
+      /// Compute the longitudinal structure functions of a batch from their \f$F_2\f$ and the \f$R\f$ ratio
+      void computeBatchFL(size_t num_points, const double* xbj, const double* q2, const double* f2, double* fl) const;
+      /// Longitudinal/transverse cross section ratio at a given point, possibly retrieved from its table
+      double sigmaRatio(double xbj, double q2) const;
 
       /// Reset the structure functions values
       Parameterisation& clear();
@@ -105,8 +133,13 @@ namespace cepgen {
       double gamma2(double xbj, double q2) const;
 
     private:
+      /// Build (or retrieve) the \f$(x_{\rm Bj},Q^2)\f$ interpolation table for the \f$R\f$ ratio
+      void tabulateSigmaRatio(const ParametersList&);
+
       /// Longitudinal/transverse cross section ratio parameterisation used to compute \f$F_{1/L}\f$
       const std::unique_ptr<sigrat::Parameterisation> r_ratio_;
+      std::unique_ptr<GridHandler<2, 1> > r_table_;  ///< Optional \f$R\f$ ratio interpolation table
+      std::array<Limits, 2> r_table_bounds_;          ///< \f$R\f$ table boundaries, in logarithmic coordinates
 
     protected:
       const double mp_;      ///< Proton mass, in GeV/c^2
@@ -118,6 +151,8 @@ namespace cepgen {
     private:
       Values vals_;
       bool fl_computed_{false};
+      std::vector<size_t> batch_ids_;     ///< Scratch buffer for the valid couples indices of a batch
+      std::vector<double> batch_buffer_;  ///< Scratch buffer for the valid couples arguments and values of a batch
     };
   }  // namespace strfun
 }  // namespace cepgen
@@ -98,7 +98,91 @@ namespace cepgen {
         }
       }
 
+    protected:
+      void computeBatch(size_t num_points, const double* xbj, const double* q2, double* f2, double* fl) override {
+        const double w2_min = w2_lim_.at(0), w2_max = w2_lim_.at(1);
+        // partition the batch into the couples to be evaluated by each of the sub-models
+        res_ids_.clear();
+        cont_ids_.clear();
+        pert_ids_.clear();
+        if (sub_values_.size() < 7 * num_points)
+          sub_values_.resize(7 * num_points);
+        auto *w2 = sub_values_.data(), *res_f2 = w2 + num_points, *res_fl = res_f2 + num_points,
+             *cont_f2 = res_fl + num_points, *cont_fl = cont_f2 + num_points, *pert_f2 = cont_fl + num_points,
+             *pert_fl = pert_f2 + num_points;
+        for (size_t i = 0; i < num_points; ++i) {
+          w2[i] = utils::mX2(xbj[i], q2[i], mp2_);
+          if (q2[i] < q2_cut_) {
+            if (w2[i] < w2_max)
+              res_ids_.emplace_back(i);
+            if (w2[i] >= w2_min)
+              cont_ids_.emplace_back(i);
+          } else if (w2[i] < w2_max)
+            cont_ids_.emplace_back(i);
+          else
+            pert_ids_.emplace_back(i);
+        }
+        // evaluate each sub-model once on its own sub-batch
+        evalSubBatch(*resonances_model_, res_ids_, xbj, q2, res_f2, fl ? res_fl : nullptr);
+        evalSubBatch(*continuum_model_, cont_ids_, xbj, q2, cont_f2, fl ? cont_fl : nullptr);
+        evalSubBatch(*perturbative_model_, pert_ids_, xbj, q2, pert_f2, fl ? pert_fl : nullptr);
+        // combine the sub-models outputs in each region
+        for (size_t i = 0; i < num_points; ++i) {
+          if (q2[i] < q2_cut_) {
+            if (w2[i] < w2_min) {
+              f2[i] = res_f2[i];
+              if (fl)
+                fl[i] = res_fl[i];
+            } else if (w2[i] < w2_max) {
+              const double r = rho(w2[i]);
+              f2[i] = r * cont_f2[i] + (1. - r) * res_f2[i];
+              if (fl)
+                fl[i] = r * cont_fl[i] + (1. - r) * res_fl[i];
+            } else {
+              f2[i] = cont_f2[i];
+              if (fl)
+                fl[i] = cont_fl[i];
+            }
+          } else {
+            if (w2[i] < w2_max) {
+              f2[i] = cont_f2[i];
+              if (fl)
+                fl[i] = cont_fl[i];
+            } else {
+              f2[i] = pert_f2[i];
+              if (fl)
+                fl[i] = pert_fl[i] * (1. + higher_twist_ / q2[i]);
+            }
+          }
+        }
+      }
+
     private:
+      /// Evaluate a sub-model on a subset of the batch, and scatter its outputs back to the full-batch indexing
+      void evalSubBatch(Parameterisation& model,
+                        const std::vector<size_t>& ids,
+                        const double* xbj,
+                        const double* q2,
+                        double* f2,
+                        double* fl) {
+        const auto num_sub = ids.size();
+        if (num_sub == 0)
+          return;
+        if (sub_args_.size() < 4 * num_sub)
+          sub_args_.resize(4 * num_sub);
+        auto *sub_xbj = sub_args_.data(), *sub_q2 = sub_xbj + num_sub, *sub_f2 = sub_q2 + num_sub,
+             *sub_fl = sub_f2 + num_sub;
+        for (size_t j = 0; j < num_sub; ++j) {
+          sub_xbj[j] = xbj[ids[j]];
+          sub_q2[j] = q2[ids[j]];
+        }
+        model.evalBatch(num_sub, sub_xbj, sub_q2, sub_f2, fl ? sub_fl : nullptr);
+        for (size_t j = 0; j < num_sub; ++j) {
+          f2[ids[j]] = sub_f2[j];
+          if (fl)
+            fl[ids[j]] = sub_fl[j];
+        }
+      }
       double rho(double w2) const {
         const double omega = (w2 - w2_lim_.at(0)) * inv_omega_range_;
         const double omega2 = omega * omega;
@@ -123,6 +207,9 @@ namespace cepgen {
       /// Continuum regions modelling
       const std::unique_ptr<Parameterisation> continuum_model_;
       double inv_omega_range_{-1.};
+      std::vector<size_t> res_ids_, cont_ids_, pert_ids_;  ///< Scratch buffers for the sub-models batch partitions
+      std::vector<double> sub_values_;                     ///< Scratch buffer for the sub-models outputs of a batch
+      std::vector<double> sub_args_;  ///< Scratch buffer for the gathered arguments/outputs of a sub-model batch
     };
   }  // namespace strfun
 }  // namespace cepgen
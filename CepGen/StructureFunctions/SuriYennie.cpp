@@ -35,7 +35,8 @@ namespace cepgen {
             d1_(steer<double>("D1")),
             rho2_(steer<double>("rho2")),
             cp_(steer<double>("Cp")),
-            bp_(steer<double>("Bp")) {}
+            bp_(steer<double>("Bp")),
+            coeffs_{c1_, c2_, d1_, rho2_, cp_, 2. * bp_, mp_, 0.5 / mp_, mp2_, 0.25 / mp2_, d1_ * rho2_ / mp2_} {}
 
       static ParametersDescription description() {
         auto desc = Parameterisation::description();
@@ -50,18 +51,8 @@ namespace cepgen {
       }
 
       void eval() override {
-        const double mx2 = utils::mX2(args_.xbj, args_.q2, mp2_), dm2 = mx2 - mp2_;  // [GeV^2]
-        const double en = args_.q2 + dm2;                                            // [GeV^2]
-        const double nu = 0.5 * en / mp_, x_pr = args_.q2 / (args_.q2 + mx2), tau = 0.25 * args_.q2 / mp2_;
-        const double mq = rho2_ + args_.q2;
-
-        const double inv_q2 = 1. / args_.q2;
-
-        const double fm = inv_q2 * (c1_ * dm2 * pow(rho2_ / mq, 2) +
-                                    c2_ * mp2_ * pow(1. - x_pr, 4) / (1. + x_pr * (x_pr * cp_ - 2. * bp_)));
-        const double fe =
-            (tau * fm + d1_ * dm2 * args_.q2 * rho2_ / mp2_ * pow(dm2 / mq / en, 2)) / (1. + nu * nu * inv_q2);
-
+        double fe, fm, nu;
+        computeFormFactors(coeffs_, args_.xbj, args_.q2, fe, fm, nu);
         setFE(fe);
         setFM(fm);
         setW1(0.5 * fm * args_.q2 / mp_);
@@ -69,11 +60,46 @@ namespace cepgen {
         setF2(2. * nu * fe);
       }
 
+    protected:
+      void computeBatch(size_t num_points, const double* xbj, const double* q2, double* f2, double* fl) override {
+        const auto coeffs = coeffs_;  // local copy, so that no coefficient is reloaded within the loop
+        for (size_t i = 0; i < num_points; ++i) {
+          double fe, fm, nu;
+          computeFormFactors(coeffs, xbj[i], q2[i], fe, fm, nu);
+          f2[i] = 2. * nu * fe;
+        }
+        computeBatchFL(num_points, xbj, q2, f2, fl);
+      }
+
     private:
+      /// Flattened set of parameterisation coefficients, with all point-independent terms precomputed
+      struct Coefficients {
+        double c1, c2, d1, rho2, cp, two_bp;
+        double mp, half_inv_mp, mp2, quarter_inv_mp2, d1_rho2_inv_mp2;
+      };
+      /// Compute the electric and magnetic form factors, and the virtual photon energy, at a given point
+      static inline void computeFormFactors(
+          const Coefficients& cf, double xbj, double q2, double& fe, double& fm, double& nu) {
+        const double mx2 = utils::mX2(xbj, q2, cf.mp2), dm2 = mx2 - cf.mp2;  // [GeV^2]
+        const double en = q2 + dm2;                                          // [GeV^2]
+        const double x_pr = q2 / (q2 + mx2), tau = q2 * cf.quarter_inv_mp2;
+        const double mq = cf.rho2 + q2;
+
+        const double inv_q2 = 1. / q2, inv_mq = 1. / mq;
+        nu = en * cf.half_inv_mp;
+
+        const double rho_ratio = cf.rho2 * inv_mq, one_m_xpr2 = (1. - x_pr) * (1. - x_pr);
+        const double dm_ratio = dm2 * inv_mq / en;
+        fm = inv_q2 * (cf.c1 * dm2 * rho_ratio * rho_ratio +
+                       cf.c2 * cf.mp2 * one_m_xpr2 * one_m_xpr2 / (1. + x_pr * (x_pr * cf.cp - cf.two_bp)));
+        fe = (tau * fm + cf.d1_rho2_inv_mp2 * dm2 * q2 * dm_ratio * dm_ratio) / (1. + nu * nu * inv_q2);
+      }
+
       double c1_{0.}, c2_{0.};
       double d1_{0.};
       double rho2_{0.};
       double cp_{0.}, bp_{0.};
+      const Coefficients coeffs_;
     };
 
     struct SuriYennieAlt final : public SuriYennie {
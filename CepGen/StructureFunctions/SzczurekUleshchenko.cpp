@@ -36,32 +36,42 @@ namespace cepgen {
       explicit SzczurekUleshchenko(const ParametersList& params)
           : Parameterisation(params), q2_shift_(steerAs<double, float>("q2shift")) {}
 
-      void eval() override {
-        auto amu2 = (float)args_.q2 + q2_shift_;  // shift the overall scale
+      void eval() override { setF2(computeF2(q2_shift_, args_.xbj, args_.q2)); }
+
+      static ParametersDescription description() {
+        auto desc = Parameterisation::description();
+        desc.setDescription("Szczurek-Uleshchenko (based on GRV parton content)");
+        desc.add<double>("q2shift", 0.8);
+        return desc;
+      }
+
+    protected:
+      void computeBatch(size_t num_points, const double* xbj, const double* q2, double* f2, double* fl) override {
+        const auto q2_shift = q2_shift_;  // local copy, so that the shift is not reloaded within the loop
+        for (size_t i = 0; i < num_points; ++i)
+          f2[i] = computeF2(q2_shift, xbj[i], q2[i]);
+        computeBatchFL(num_points, xbj, q2, f2, fl);
+      }
+
+    private:
+      static inline double computeF2(float q2_shift, double xbj, double q2) {
+        auto amu2 = (float)q2 + q2_shift;  // shift the overall scale
         float xuv, xdv, xus, xds, xss, xg;
-        auto xbj_arg = (float)args_.xbj;
+        auto xbj_arg = (float)xbj;
 
         grv95lo_(xbj_arg, amu2, xuv, xdv, xus, xds, xss, xg);
 
         CG_DEBUG_LOOP("SzczurekUleshchenko")
-            << "Form factor content at xB = " << args_.xbj << " (scale = " << amu2 << " GeV^2):\n\t"
+            << "Form factor content at xB = " << xbj << " (scale = " << amu2 << " GeV^2):\n\t"
             << "  valence quarks: u / d     = " << xuv << " / " << xdv << "\n\t"
             << "  sea quarks:     u / d / s = " << xus << " / " << xds << " / " << xss << "\n\t"
             << "  gluons:                   = " << xg;
 
         // standard partonic structure function
         const double F2_aux = 4. / 9. * (xuv + 2. * xus) + 1. / 9. * (xdv + 2. * xds) + 1. / 9. * (2. * xss);
-        setF2(F2_aux * args_.q2 / amu2);  // F2 corrected for low Q^2 behaviour
+        return F2_aux * q2 / amu2;  // F2 corrected for low Q^2 behaviour
       }
 
-      static ParametersDescription description() {
-        auto desc = Parameterisation::description();
-        desc.setDescription("Szczurek-Uleshchenko (based on GRV parton content)");
-        desc.add<double>("q2shift", 0.8);
-        return desc;
-      }
-
-    private:
       /// \f$Q^2\f$ scale shift
       const float q2_shift_;
     };
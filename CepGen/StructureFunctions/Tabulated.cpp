@@ -0,0 +1,229 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <sstream>
+
+#include "CepGen/Core/Exception.h"
+#include "CepGen/Modules/StructureFunctionsFactory.h"
+#include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/GridHandler.h"
+
+namespace cepgen {
+  namespace strfun {
+    /// Tabulated wrapper around any structure functions parameterisation
+    /// \note The \f$F_{2,L}\f$ values are sampled once on a \f$\log x_{\rm Bj}\times\log Q^2\f$ grid, adaptively
+    ///   refined until the bilinear interpolation reproduces the wrapped parameterisation within a relative tolerance.
+    ///   Points outside the tabulated range are forwarded to the wrapped parameterisation.
+    class Tabulated final : public Parameterisation, private GridHandler<2, 2> {
+    public:
+      explicit Tabulated(const ParametersList& params)
+          : Parameterisation(params),
+            GridHandler<2, 2>(GridType::logarithmic),
+            sf_(StructureFunctionsFactory::get().build(steer<ParametersList>("structureFunctions"))),
+            xbj_range_(steer<Limits>("xBjRange")),
+            q2_range_(steer<Limits>("Q2range")),
+            tolerance_(steer<double>("tolerance")) {
+        if (xbj_range_.min() <= 0. || xbj_range_.max() >= 1. || xbj_range_.min() >= xbj_range_.max())
+          throw CG_FATAL("Tabulated") << "Invalid xBj range for the tabulation: " << xbj_range_ << ".";
+        if (q2_range_.min() <= 0. || q2_range_.min() >= q2_range_.max())
+          throw CG_FATAL("Tabulated") << "Invalid Q^2 range for the tabulation: " << q2_range_ << ".";
+        if (tolerance_ <= 0.)
+          throw CG_FATAL("Tabulated") << "Invalid relative tolerance for the tabulation: " << tolerance_ << ".";
+        const auto key = configurationHash();
+        const auto& grid_path = steer<std::string>("gridPath");
+        if (grid_path.empty() || !load(grid_path, key)) {
+          build();
+          if (!grid_path.empty())
+            save(grid_path, key);
+        }
+        grid_bounds_ = boundaries();
+        CG_INFO("Tabulated") << "Structure functions tabulated for " << *sf_ << " on a " << coords_.at(0).size() << "x"
+                             << coords_.at(1).size() << " grid with a relative tolerance of " << tolerance_ << ".\n\t"
+                             << "xBj in range " << xbj_range_ << ", Q² in range " << q2_range_ << ".";
+      }
+
+      static ParametersDescription description() {
+        auto desc = Parameterisation::description();
+        desc.setDescription("Tabulated structure functions");
+        desc.add<ParametersDescription>("structureFunctions", ParametersDescription().setName<int>(102))
+            .setDescription("structure functions parameterisation to tabulate");
+        desc.add<Limits>("xBjRange", Limits{1.e-6, 0.999}).setDescription("xBj range covered by the table");
+        desc.add<Limits>("Q2range", Limits{1.e-4, 1.e4}).setDescription("Q^2 range covered by the table (in GeV^2)");
+        desc.add<double>("tolerance", 1.e-3).setDescription("maximal relative interpolation uncertainty");
+        desc.add<int>("initialNodes", 32).setDescription("initial number of grid nodes along each axis");
+        desc.add<int>("maxRefinements", 6).setDescription("maximal number of grid refinement iterations");
+        desc.add<int>("maxNodes", 1024).setDescription("maximal number of grid nodes along each axis");
+        desc.add<std::string>("gridPath", "")
+            .setDescription("path to a table file to reload (or to write if invalid or missing; disabled if empty)");
+        return desc;
+      }
+
+      //--- already retrieved from the table, so no need to recompute it
+      Tabulated& computeFL(double, double) override { return *this; }
+      Tabulated& computeFL(double, double, double) override { return *this; }
+
+    private:
+      void eval() override {
+        if (!grid_bounds_[0].contains(std::log10(args_.xbj)) || !grid_bounds_[1].contains(std::log10(args_.q2))) {
+          setF2(sf_->F2(args_.xbj, args_.q2));
+          setFL(sf_->FL(args_.xbj, args_.q2));
+          return;
+        }
+        const auto& val = GridHandler<2, 2>::eval({args_.xbj, args_.q2});
+        setF2(val.at(0));
+        setFL(val.at(1));
+      }
+
+      /// Evaluate the wrapped parameterisation at a given \f$(\log x_{\rm Bj},\log Q^2)\f$ node
+      values_t evalNode(double log_xbj, double log_q2) {
+        const auto xbj = std::pow(10., log_xbj), q2 = std::pow(10., log_q2);
+        const auto f2 = sf_->F2(xbj, q2);  // F2 must be computed first, as FL might be derived from it
+        return values_t{f2, sf_->FL(xbj, q2)};
+      }
+      /// Relative difference between an interpolated and an exact value
+      double relativeError(const values_t& interp, const values_t& exact) const {
+        const auto norm = std::max({std::fabs(exact.at(0)), std::fabs(interp.at(0)), 1.e-10});
+        return std::max(std::fabs(interp.at(0) - exact.at(0)), std::fabs(interp.at(1) - exact.at(1))) / norm;
+      }
+      /// Sample the wrapped parameterisation and refine the grid until the interpolation tolerance is reached
+      void build() {
+        std::vector<double> nodes_xbj, nodes_q2;  // grid nodes coordinates
+        std::vector<values_t> nodes_values;       // (F2, FL) values at all grid nodes
+        const auto index = [&nodes_q2](size_t i, size_t j) { return i * nodes_q2.size() + j; };
+        const auto num_init = std::max(steer<int>("initialNodes"), 2);
+        const auto max_nodes = (size_t)std::max(steer<int>("maxNodes"), num_init);
+        const auto max_refinements = steer<int>("maxRefinements");
+        const Limits lxbj_range{std::log10(xbj_range_.min()), std::log10(xbj_range_.max())},
+            lq2_range{std::log10(q2_range_.min()), std::log10(q2_range_.max())};
+        nodes_xbj = lxbj_range.generate(num_init);
+        nodes_q2 = lq2_range.generate(num_init);
+        nodes_values.resize(nodes_xbj.size() * nodes_q2.size());
+        for (size_t i = 0; i < nodes_xbj.size(); ++i)
+          for (size_t j = 0; j < nodes_q2.size(); ++j)
+            nodes_values[index(i, j)] = evalNode(nodes_xbj.at(i), nodes_q2.at(j));
+
+        const auto average = [](const values_t& v1, const values_t& v2) {
+          return values_t{0.5 * (v1.at(0) + v2.at(0)), 0.5 * (v1.at(1) + v2.at(1))};
+        };
+        double max_error = 0.;
+        for (int it = 0; it <= max_refinements; ++it) {
+          const auto nx = nodes_xbj.size(), nq = nodes_q2.size();
+          // exact values at the middle of all grid edges and cells (in logarithmic coordinates), which are also the
+          // values of the nodes to be added if an interval is split
+          std::vector<values_t> mid_x((nx - 1) * nq), mid_q(nx * (nq - 1)), mid_c((nx - 1) * (nq - 1));
+          std::vector<bool> split_x(nx - 1, false), split_q(nq - 1, false);
+          max_error = 0.;
+          for (size_t i = 0; i < nx; ++i)
+            for (size_t j = 0; j < nq; ++j) {
+              const auto& val = nodes_values.at(index(i, j));
+              if (i + 1 < nx) {
+                auto& mid = mid_x[i * nq + j];
+                mid = evalNode(0.5 * (nodes_xbj.at(i) + nodes_xbj.at(i + 1)), nodes_q2.at(j));
+                const auto err = relativeError(average(val, nodes_values.at(index(i + 1, j))), mid);
+                max_error = std::max(max_error, err);
+                if (err > tolerance_)
+                  split_x[i] = true;
+              }
+              if (j + 1 < nq) {
+                auto& mid = mid_q[i * (nq - 1) + j];
+                mid = evalNode(nodes_xbj.at(i), 0.5 * (nodes_q2.at(j) + nodes_q2.at(j + 1)));
+                const auto err = relativeError(average(val, nodes_values.at(index(i, j + 1))), mid);
+                max_error = std::max(max_error, err);
+                if (err > tolerance_)
+                  split_q[j] = true;
+              }
+              if (i + 1 < nx && j + 1 < nq) {
+                auto& mid = mid_c[i * (nq - 1) + j];
+                mid = evalNode(0.5 * (nodes_xbj.at(i) + nodes_xbj.at(i + 1)),
+                               0.5 * (nodes_q2.at(j) + nodes_q2.at(j + 1)));
+                const auto err = relativeError(
+                    average(average(val, nodes_values.at(index(i + 1, j))),
+                            average(nodes_values.at(index(i, j + 1)), nodes_values.at(index(i + 1, j + 1)))),
+                    mid);
+                max_error = std::max(max_error, err);
+                if (err > tolerance_)
+                  split_x[i] = split_q[j] = true;
+              }
+            }
+          const auto num_split_x = std::count(split_x.begin(), split_x.end(), true),
+                     num_split_q = std::count(split_q.begin(), split_q.end(), true);
+          CG_DEBUG("Tabulated") << "Refinement iteration " << it << ": " << nx << "x" << nq
+                                << " grid, maximal relative error: " << max_error << ", " << num_split_x << "/"
+                                << num_split_q << " xBj/Q² intervals to split.";
+          if ((num_split_x == 0 && num_split_q == 0) || it == max_refinements || nx + num_split_x > max_nodes ||
+              nq + num_split_q > max_nodes)
+            break;
+          // build the refined grid from the already evaluated nodes
+          std::vector<double> log_xbj, log_q2;
+          std::vector<std::pair<size_t, short> > src_x, src_q;  // (index, 0 = node, 1 = middle of the interval)
+          for (size_t i = 0; i < nx; ++i) {
+            log_xbj.emplace_back(nodes_xbj.at(i)), src_x.emplace_back(i, 0);
+            if (i + 1 < nx && split_x.at(i))
+              log_xbj.emplace_back(0.5 * (nodes_xbj.at(i) + nodes_xbj.at(i + 1))), src_x.emplace_back(i, 1);
+          }
+          for (size_t j = 0; j < nq; ++j) {
+            log_q2.emplace_back(nodes_q2.at(j)), src_q.emplace_back(j, 0);
+            if (j + 1 < nq && split_q.at(j))
+              log_q2.emplace_back(0.5 * (nodes_q2.at(j) + nodes_q2.at(j + 1))), src_q.emplace_back(j, 1);
+          }
+          std::vector<values_t> values;
+          values.reserve(log_xbj.size() * log_q2.size());
+          for (const auto& sx : src_x)
+            for (const auto& sq : src_q) {
+              if (sx.second == 0 && sq.second == 0)
+                values.emplace_back(nodes_values.at(index(sx.first, sq.first)));
+              else if (sx.second == 1 && sq.second == 0)
+                values.emplace_back(mid_x.at(sx.first * nq + sq.first));
+              else if (sx.second == 0 && sq.second == 1)
+                values.emplace_back(mid_q.at(sx.first * (nq - 1) + sq.first));
+              else
+                values.emplace_back(mid_c.at(sx.first * (nq - 1) + sq.first));
+            }
+          nodes_xbj = std::move(log_xbj);
+          nodes_q2 = std::move(log_q2);
+          nodes_values = std::move(values);
+        }
+        for (size_t i = 0; i < nodes_xbj.size(); ++i)
+          for (size_t j = 0; j < nodes_q2.size(); ++j)
+            insert({std::pow(10., nodes_xbj.at(i)), std::pow(10., nodes_q2.at(j))}, nodes_values.at(index(i, j)));
+        initialise();
+        if (max_error > tolerance_)
+          CG_WARNING("Tabulated") << "Relative tolerance of " << tolerance_ << " not reached for the tabulation of "
+                                  << *sf_ << ". Maximal relative error: " << max_error << ".";
+      }
+
+      /// Hash of the configuration the table is built for
+      size_t configurationHash() const {
+        std::ostringstream os;
+        os << steer<ParametersList>("structureFunctions").serialise() << "|" << xbj_range_ << "|" << q2_range_ << "|"
+           << tolerance_ << "|" << steer<int>("initialNodes") << "|" << steer<int>("maxRefinements") << "|"
+           << steer<int>("maxNodes");
+        return std::hash<std::string>()(os.str());
+      }
+
+      const std::unique_ptr<Parameterisation> sf_;  ///< Wrapped structure functions parameterisation
+      const Limits xbj_range_;                      ///< Tabulated \f$x_{\rm Bj}\f$ range
+      const Limits q2_range_;                       ///< Tabulated \f$Q^2\f$ range
+      const double tolerance_;                      ///< Maximal relative interpolation uncertainty
+      std::array<Limits, 2> grid_bounds_;           ///< Grid boundaries, in logarithmic coordinates
+    };
+  }  // namespace strfun
+}  // namespace cepgen
+using cepgen::strfun::Tabulated;
+REGISTER_STRFUN(501, Tabulated);
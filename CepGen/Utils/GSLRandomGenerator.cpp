@@ -61,6 +61,7 @@ namespace cepgen {
     double uniform(double min, double max) override { return Limits{min, max}.x(gsl_rng_uniform(rng_.get())); }
     double normal(double mean, double rms) override { return gsl_ran_gaussian(rng_.get(), rms) + mean; }
     double exponential(double exponent) override { return gsl_ran_exponential(rng_.get(), exponent); }
+    void setSeed(unsigned long long seed) override { gsl_rng_set(rng_.get(), seed_ = seed); }
 
   private:
     /// A deleter object for GSL's random number generator
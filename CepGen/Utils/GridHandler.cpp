@@ -16,111 +16,114 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <fcntl.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_math.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <limits>
+#include <sstream>
 
 #include "CepGen/Core/Exception.h"
+#include "CepGen/Core/ParametersDescription.h"
+#include "CepGen/Utils/Filesystem.h"
 #include "CepGen/Utils/GridHandler.h"
+#include "CepGen/Utils/String.h"
 
 //#define GRID_HANDLER_DEBUG 1
 
 namespace cepgen {
   template <size_t D, size_t N>
-  GridHandler<D, N>::GridHandler(const GridType& grid_type) : grid_type_(grid_type) {
-    for (size_t i = 0; i < D; ++i)
-      accel_.emplace_back(gsl_interp_accel_alloc(), gsl_interp_accel_free);
-  }
+  GridHandler<D, N>::GridHandler(const GridType& grid_type, bool clamp) : grid_type_(grid_type), clamp_(clamp) {}
 
   template <size_t D, size_t N>
-  typename GridHandler<D, N>::values_t GridHandler<D, N>::eval(coord_t in_coords) const {
+  typename GridHandler<D, N>::values_t GridHandler<D, N>::eval(point_t in_coords) const {
     if (!init_)
       throw CG_FATAL("GridHandler") << "Grid extrapolator called but not initialised!";
 
-    values_t out{};
-    coord_t coord = in_coords;
+    auto coord = in_coords;
     switch (grid_type_) {
       case GridType::logarithmic: {
-        std::transform(coord.begin(), coord.end(), coord.begin(), [](const auto& c) { return log10(c); });
+        for (auto& c : coord)
+          c = std::log10(c);
       } break;
       case GridType::square: {
-        std::transform(coord.begin(), coord.end(), coord.begin(), [](const auto& c) { return c * c; });
+        for (auto& c : coord)
+          c *= c;
       } break;
       default:
         break;
     }
-    //--- dimension of the vector space coordinate to evaluate
-    switch (D) {
-      case 1: {
-        for (size_t i = 0; i < N; ++i) {
-          int res = gsl_spline_eval_e(splines_1d_.at(i).get(), coord.at(0), accel_.at(0).get(), &out[i]);
-          if (res != GSL_SUCCESS) {
-            out[i] = 0.;
-            CG_WARNING("GridHandler") << "Failed to evaluate the value (N=" << i << ") "
-                                      << "for x = " << in_coords.at(0) << " in grid with boundaries " << boundaries()
-                                      << ". GSL error: " << gsl_strerror(res);
-          }
-        }
-      } break;
-      case 2: {
-#ifdef GSL_VERSION_ABOVE_2_1
-        const double x = coord.at(0), y = coord.at(1);
-        for (size_t i = 0; i < N; ++i) {
-          int res = gsl_spline2d_eval_e(splines_2d_.at(i).get(), x, y, accel_.at(0).get(), accel_.at(1).get(), &out[i]);
-          if (res != GSL_SUCCESS) {
-            out[i] = 0.;
-            CG_WARNING("GridHandler") << "Failed to evaluate the value (N=" << i << ") "
-                                      << "for x = " << x << " / y = " << y << " in grid with boundaries "
-                                      << boundaries() << ". GSL error: " << gsl_strerror(res);
-          }
-        }
-#else
-        //--- retrieve the indices of the bin in the set
-        coord_t before(D), after(D);
-        findIndices(coord, before, after);
-        //--- find boundaries values
-        const gridpoint_t &ext_11 = values_raw_.at({before[0], before[1]}),
-                          &ext_12 = values_raw_.at({before[0], after[1]}),
-                          &ext_21 = values_raw_.at({after[0], before[1]}),
-                          &ext_22 = values_raw_.at({after[0], after[1]});
-        //--- now that we have the boundaries, we may interpolate
-        coord_t c_d(D);
+    if constexpr (D > 1) {
+      if (!clamp_)
         for (size_t i = 0; i < D; ++i)
-          c_d[i] = (after[i] != before[i]) ? (coord.at(i) - before[i]) / (after[i] - before[i]) : 0.;
-        const gridpoint_t ext_1 = ext_11 * (1. - c_d[0]) + ext_21 * c_d[0];
-        const gridpoint_t ext_2 = ext_12 * (1. - c_d[0]) + ext_22 * c_d[0];
-        out = ext_1 * (1. - c_d[1]) + ext_2 * c_d[1];
-#endif
-      } break;
-      case 3: {
-        //--- retrieve the indices of the bin in the set
-        coord_t before(D), after(D);
-        findIndices(coord, before, after);
-        //--- find boundaries values
-        const gridpoint_t &ext_111 = values_raw_.at({before[0], before[1], before[2]}),
-                          &ext_112 = values_raw_.at({before[0], before[1], after[2]}),
-                          &ext_121 = values_raw_.at({before[0], after[1], before[2]}),
-                          &ext_122 = values_raw_.at({before[0], after[1], after[2]}),
-                          &ext_211 = values_raw_.at({after[0], before[1], before[2]}),
-                          &ext_212 = values_raw_.at({after[0], before[1], after[2]}),
-                          &ext_221 = values_raw_.at({after[0], after[1], before[2]}),
-                          &ext_222 = values_raw_.at({after[0], after[1], after[2]});
-        //--- now that we have the boundaries, we may interpolate
-        coord_t c_d(D);
-        for (size_t i = 0; i < D; ++i)
-          c_d[i] = (after[i] != before[i]) ? (coord.at(i) - before[i]) / (after[i] - before[i]) : 0.;
-        const gridpoint_t ext_11 = ext_111 * (1. - c_d[0]) + ext_211 * c_d[0];
-        const gridpoint_t ext_12 = ext_112 * (1. - c_d[0]) + ext_212 * c_d[0];
-        const gridpoint_t ext_21 = ext_121 * (1. - c_d[0]) + ext_221 * c_d[0];
-        const gridpoint_t ext_22 = ext_122 * (1. - c_d[0]) + ext_222 * c_d[0];
-        const gridpoint_t ext_1 = ext_11 * (1. - c_d[1]) + ext_21 * c_d[1];
-        const gridpoint_t ext_2 = ext_12 * (1. - c_d[1]) + ext_22 * c_d[1];
-        out = ext_1 * (1. - c_d[2]) + ext_2 * c_d[2];
-      } break;
-      default:
-        throw CG_FATAL("GridHandler") << "Unsupported number of dimensions: " << N << ".\n\t"
-                                      << "Please contact the developers to add such a new feature.";
+          if (outOfRange(i, coord[i])) {
+            CG_WARNING("GridHandler") << "Failed to evaluate the values for x = " << in_coords
+                                      << " in grid with boundaries " << boundaries() << ": out of range.";
+            return values_t{};
+          }
+      return interpolate(coord);
+    }
+    //--- one-dimensional case: spline interpolation
+    if (clamp_)
+      coord[0] = std::clamp(coord[0], coords_[0].front(), coords_[0].back());
+    // one accelerator per thread (and per grid), so that concurrent evaluations do not share its lookup cache
+    struct Accelerator {
+      size_t grid_id{0};
+      std::unique_ptr<gsl_interp_accel, void (*)(gsl_interp_accel*)> accel{gsl_interp_accel_alloc(),
+                                                                           gsl_interp_accel_free};
+    };
+    thread_local Accelerator accelerator;
+    if (accelerator.grid_id != accel_id_) {  // last used for another grid
+      gsl_interp_accel_reset(accelerator.accel.get());
+      accelerator.grid_id = accel_id_;
+    }
+    values_t out{};
+    for (size_t i = 0; i < N; ++i) {
+      int res = gsl_spline_eval_e(splines_1d_.at(i).get(), coord[0], accelerator.accel.get(), &out[i]);
+      if (res != GSL_SUCCESS) {
+        out[i] = 0.;
+        CG_WARNING("GridHandler") << "Failed to evaluate the value (N=" << i << ") "
+                                  << "for x = " << in_coords[0] << " in grid with boundaries " << boundaries()
+                                  << ". GSL error: " << gsl_strerror(res);
+      }
+    }
+    return out;
+  }
+
+  template <size_t D, size_t N>
+  bool GridHandler<D, N>::outOfRange(size_t dim, double coord) const {
+    const auto& c = coords_[dim];
+    return coord < c.front() || coord > c.back();
+  }
+
+  template <size_t D, size_t N>
+  typename GridHandler<D, N>::values_t GridHandler<D, N>::interpolate(const point_t& coord) const {
+    std::array<size_t, D> index{};
+    std::array<double, D> frac{};
+    for (size_t i = 0; i < D; ++i)
+      locate(i, coord[i], index[i], frac[i]);
+    //--- weighted sum over all 2^D corners of the cell
+    values_t out{};
+    for (size_t corner = 0; corner < (1ull << D); ++corner) {
+      double weight = 1.;
+      size_t offset = 0;
+      for (size_t i = 0; i < D; ++i) {
+        const bool upper = (corner >> i) & 1;
+        weight *= upper ? frac[i] : 1. - frac[i];
+        offset += (index[i] + upper) * strides_[i];
+      }
+      if (weight == 0.)  // also skips the out-of-grid upper corners of a clamped coordinate
+        continue;
+      const auto& vals = nodes_[offset];
+      for (size_t j = 0; j < N; ++j)
+        out[j] += weight * vals[j];
     }
     return out;
   }
@@ -146,11 +149,76 @@ namespace cepgen {
     init_ = false;
   }
 
+  template <size_t D, size_t N>
+  std::optional<double> GridHandler<D, N>::tabulate(const std::array<coord_t, D>& nodes,
+                                                    const std::function<values_t(const point_t&)>& func,
+                                                    const ParametersList& params,
+                                                    size_t key,
+                                                    const std::function<double(double)>& unmap) {
+    const auto& grid_path = params.get<std::string>("gridPath");
+    if (!grid_path.empty() && load(grid_path, key))
+      return std::nullopt;  // validated when first built
+    size_t num_nodes = 1;
+    for (const auto& axis_nodes : nodes) {
+      if (axis_nodes.empty())
+        throw CG_FATAL("GridHandler:tabulate") << "No node defined along one of the grid axes.";
+      num_nodes *= axis_nodes.size();
+    }
+    point_t point{};
+    for (size_t node = 0; node < num_nodes; ++node) {
+      size_t rest = node;
+      for (size_t i = D; i > 0; --i) {  // last coordinate runs fastest
+        point[i - 1] = nodes[i - 1][rest % nodes[i - 1].size()];
+        rest /= nodes[i - 1].size();
+      }
+      insert(coord_t(point.begin(), point.end()), func(point));
+    }
+    initialise();
+    if (!grid_path.empty())
+      save(grid_path, key);
+
+    // validate the interpolation against exact evaluations at the centre of a few grid cells
+    static constexpr std::array<size_t, 4> cell_pickers{7919ul, 104729ul, 1299709ul, 15485863ul};
+    const auto centre = [this](size_t axis, size_t step) {
+      const auto& c = coords_.at(axis);
+      if (c.size() < 2)  // single node along this axis
+        return fromGridCoordinate(c.at(0));
+      const auto index = (step * cell_pickers.at(axis % cell_pickers.size())) % (c.size() - 1);
+      return fromGridCoordinate(0.5 * (c.at(index) + c.at(index + 1)));
+    };
+    const auto num_checks = params.get<int>("numSpotChecks");
+    double max_error = 0.;
+    for (int i = 0; i < num_checks; ++i) {
+      for (size_t j = 0; j < D; ++j)
+        point[j] = centre(j, i);
+      const auto exact = func(point), interp = eval(point);
+      for (size_t j = 0; j < N; ++j)
+        if (const auto val_exact = unmap ? unmap(exact[j]) : exact[j]; val_exact != 0.)
+          max_error = std::max(max_error, std::fabs((unmap ? unmap(interp[j]) : interp[j]) / val_exact - 1.));
+    }
+    if (const auto tolerance = params.get<double>("tolerance"); max_error > tolerance)
+      CG_WARNING("GridHandler:tabulate") << "Maximal relative interpolation uncertainty (" << max_error << ") from "
+                                         << utils::s("spot check", num_checks, true) << " is above the tolerance ("
+                                         << tolerance << "). Consider increasing the number of nodes.";
+    return max_error;
+  }
+
+  template <size_t D, size_t N>
+  double GridHandler<D, N>::fromGridCoordinate(double coord) const {
+    switch (grid_type_) {
+      case GridType::logarithmic:
+        return std::pow(10., coord);
+      case GridType::square:
+        return std::sqrt(coord);
+      default:
+        return coord;
+    }
+  }
+
   template <size_t D, size_t N>
   void GridHandler<D, N>::initialise() {
     if (values_raw_.empty())
       throw CG_ERROR("GridHandler") << "Empty grid.";
-    gsl_set_error_handler_off();
     //--- start by building grid coordinates from raw values
     for (auto& c : coords_)
       c.clear();
@@ -177,83 +245,23 @@ namespace cepgen {
       }
     });
 #endif
-    //--- particularise by dimension
-    switch (D) {
-      case 1: {  //--- x |-> (f1,...)
-        const gsl_interp_type* type = gsl_interp_cspline;
-        //const gsl_interp_type* type = gsl_interp_steffen;
-#ifdef GSL_VERSION_ABOVE_2_1
-        const unsigned short min_size = gsl_interp_type_min_size(type);
-#else
-        const unsigned short min_size = type->min_size;
-#endif
-        if (min_size >= values_raw_.size())
-          throw CG_FATAL("GridHandler") << "Not enough points for \"" << type->name << "\" type of interpolation.\n\t"
-                                        << "Minimum required: " << min_size << ", got " << values_raw_.size() << "!";
-        for (size_t i = 0; i < N; ++i) {
-          values_[i].reset(new double[values_raw_.size()]);
-          splines_1d_.emplace_back(gsl_spline_alloc(type, values_raw_.size()), gsl_spline_free);
-        }
-        // transform a map(coord -> values) to
-        // - 1 vector(coordinates)
-        // - N vectors(values)
-        std::vector<double> x_vec;
-        size_t i = 0;
-        for (const auto& vals : values_raw_) {
-          x_vec.emplace_back(vals.first.at(0));
-          unsigned short j = 0;
-          for (const auto& val : vals.second)
-            values_[j++].get()[i] = val;
-          ++i;
-        }
-        // initialise spline interpolation objects (one for each value)
-        for (size_t j = 0; j < splines_1d_.size(); ++j)
-          gsl_spline_init(splines_1d_.at(j).get(), &x_vec[0], values_[j].get(), values_raw_.size());
-      } break;
-      case 2: {  //--- (x,y) |-> (f1,...)
-#ifdef GSL_VERSION_ABOVE_2_1
-        if (values_raw_.size() < gsl_interp2d_type_min_size(gsl_interp2d_bicubic))
-          CG_WARNING("GridHandler") << "The grid size is too small (" << values_raw_.size() << " < "
-                                    << gsl_interp2d_type_min_size(gsl_interp2d_bicubic)
-                                    << ") for bicubic interpolation. Switching to a bilinear interpolation mode.";
-        //const gsl_interp2d_type* type =
-        //    (values_raw_.size() > gsl_interp2d_type_min_size(gsl_interp2d_bicubic) ? gsl_interp2d_bicubic
-        //                                                                           : gsl_interp2d_bilinear);
-        const gsl_interp2d_type* type = gsl_interp2d_bilinear;
-        splines_2d_.clear();
-        for (size_t i = 0; i < N; ++i) {
-          values_[i].reset(new double[coords_.at(0).size() * coords_.at(1).size()]);
-          splines_2d_.emplace_back(gsl_spline2d_alloc(type, coords_.at(0).size(), coords_.at(1).size()),
-                                   gsl_spline2d_free);
-        }
-
-        // second loop over all points to populate the grid
-        for (const auto& val : values_raw_) {
-          double val_x = val.first.at(0), val_y = val.first.at(1);
-          // retrieve the index of the bin in the set
-          const unsigned short id_x =
-              std::distance(coords_.at(0).begin(), std::lower_bound(coords_.at(0).begin(), coords_.at(0).end(), val_x));
-          const unsigned short id_y =
-              std::distance(coords_.at(1).begin(), std::lower_bound(coords_.at(1).begin(), coords_.at(1).end(), val_y));
-          for (unsigned short i = 0; i < splines_2d_.size(); ++i)
-            gsl_spline2d_set(splines_2d_.at(i).get(), values_[i].get(), id_x, id_y, val.second[i]);
-        }
-
-        // initialise spline interpolation objects (one for each value)
-        const coord_t &x_vec = coords_.at(0), &y_vec = coords_.at(1);
-        for (size_t i = 0; i < splines_2d_.size(); ++i)
-          gsl_spline2d_init(
-              splines_2d_.at(i).get(), &x_vec[0], &y_vec[0], values_[i].get(), x_vec.size(), y_vec.size());
-#else
-        CG_WARNING("GridHandler") << "GSL version ≥ 2.1 is required for spline bilinear interpolation.\n\t"
-                                  << "Version " << GSL_VERSION << " is installed on this system!\n\t"
-                                  << "Will use a simple bilinear approximation instead.";
-#endif
-      } break;
-      default:
-        break;
+    //--- fill the contiguous nodes values collection
+    const auto num_nodes = computeStrides();
+    if (num_nodes != values_raw_.size())
+      CG_WARNING("GridHandler") << "Grid is not fully populated: " << values_raw_.size() << " values for " << num_nodes
+                                << " nodes. Missing nodes will be set to zero.";
+    nodes_values_.assign(num_nodes, values_t{});
+    for (const auto& val : values_raw_) {
+      size_t offset = 0;
+      for (size_t i = 0; i < D; ++i)
+        offset += std::distance(coords_.at(i).begin(),
+                                std::lower_bound(coords_.at(i).begin(), coords_.at(i).end(), val.first.at(i))) *
+                  strides_[i];
+      nodes_values_[offset] = val.second;
     }
-    init_ = true;
+    nodes_ = nodes_values_.data();
+    mapping_.reset();
+    prepare();
     CG_DEBUG("GridHandler").log([&](auto& log) {
       log << "Grid evaluator initialised with boundaries: " << boundaries() << ".";
 #ifdef GRID_HANDLER_DEBUG
@@ -264,6 +272,173 @@ namespace cepgen {
     });
   }
 
+  template <size_t D, size_t N>
+  size_t GridHandler<D, N>::computeStrides() {
+    size_t num_nodes = 1;
+    for (size_t i = D; i-- > 0;) {
+      strides_[i] = num_nodes;
+      num_nodes *= coords_.at(i).size();
+    }
+    return num_nodes;
+  }
+
+  template <size_t D, size_t N>
+  void GridHandler<D, N>::prepare() {
+    gsl_set_error_handler_off();
+    static std::atomic<size_t> num_prepared{0};
+    accel_id_ = ++num_prepared;  // invalidates all accelerators used for a previous content of this grid
+    if constexpr (D == 1) {  //--- x |-> (f1,...): build the spline interpolators
+      const gsl_interp_type* type = gsl_interp_cspline;
+      //const gsl_interp_type* type = gsl_interp_steffen;
+#ifdef GSL_VERSION_ABOVE_2_1
+      const unsigned short min_size = gsl_interp_type_min_size(type);
+#else
+      const unsigned short min_size = type->min_size;
+#endif
+      const auto& x_vec = coords_.at(0);
+      if (min_size >= x_vec.size())
+        throw CG_FATAL("GridHandler") << "Not enough points for \"" << type->name << "\" type of interpolation.\n\t"
+                                      << "Minimum required: " << min_size << ", got " << x_vec.size() << "!";
+      splines_1d_.clear();
+      for (size_t i = 0; i < N; ++i) {
+        // transform the nodes values into N vectors(values)
+        values_[i].reset(new double[x_vec.size()]);
+        for (size_t j = 0; j < x_vec.size(); ++j)
+          values_[i][j] = nodes_[j][i];
+        // initialise spline interpolation objects (one for each value)
+        splines_1d_.emplace_back(gsl_spline_alloc(type, x_vec.size()), gsl_spline_free);
+        gsl_spline_init(splines_1d_.back().get(), x_vec.data(), values_[i].get(), x_vec.size());
+      }
+    }
+    init_ = true;
+  }
+
+  template <size_t D, size_t N>
+  std::map<typename GridHandler<D, N>::coord_t, typename GridHandler<D, N>::values_t> GridHandler<D, N>::values()
+      const {
+    if (!values_raw_.empty() || !nodes_)
+      return values_raw_;
+    // grid retrieved from a cache file; rebuild the list of values from the nodes
+    std::map<coord_t, values_t> out;
+    size_t num_nodes = 1;
+    for (const auto& c : coords_)
+      num_nodes *= c.size();
+    for (size_t offset = 0; offset < num_nodes; ++offset) {
+      coord_t coord(D);
+      for (size_t i = 0; i < D; ++i)
+        coord[i] = coords_[i][(offset / strides_[i]) % coords_[i].size()];
+      out[coord] = nodes_[offset];
+    }
+    return out;
+  }
+
+  template <size_t D, size_t N>
+  bool GridHandler<D, N>::save(const std::string& filename, size_t key) const {
+    if (!init_)
+      throw CG_FATAL("GridHandler:save") << "Grid must be initialised before being saved!";
+    // write into a unique temporary file in the same directory, then atomically replace the target; the
+    // previous file content remains available to the processes (or grids) which already mapped it
+    static std::atomic<unsigned long> num_saved{0};
+    size_t num_nodes = 1;
+    for (const auto& c : coords_)
+      num_nodes *= c.size();
+    const auto tmp_filename = utils::format("%s.tmp.%d.%lu", filename.c_str(), (int)::getpid(), num_saved++);
+    {
+      std::ofstream file(tmp_filename, std::ios::binary | std::ios::out | std::ios::trunc);
+      if (!file.is_open()) {
+        CG_DEBUG("GridHandler:save") << "Failed to open grid cache file '" << tmp_filename << "' for writing.";
+        return false;
+      }
+      header_t header{GOOD_MAGIC, VERSION, D, N, (unsigned short)grid_type_, key, {}};
+      for (size_t i = 0; i < D; ++i)
+        header.num_coords[i] = coords_[i].size();
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header_t));
+      for (const auto& c : coords_)
+        file.write(reinterpret_cast<const char*>(c.data()), c.size() * sizeof(double));
+      file.write(reinterpret_cast<const char*>(nodes_), num_nodes * sizeof(values_t));
+      file.close();
+      if (!file.good()) {
+        CG_WARNING("GridHandler:save") << "Failed to write grid cache file '" << tmp_filename << "'.";
+        std::remove(tmp_filename.c_str());
+        return false;
+      }
+    }
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+      CG_WARNING("GridHandler:save") << "Failed to move grid cache file '" << tmp_filename << "' to '" << filename
+                                     << "'.";
+      std::remove(tmp_filename.c_str());
+      return false;
+    }
+    CG_DEBUG("GridHandler:save") << "Grid with " << utils::s("node", num_nodes, true) << " saved into '" << filename
+                                 << "'.";
+    return true;
+  }
+
+  template <size_t D, size_t N>
+  bool GridHandler<D, N>::load(const std::string& filename, size_t key) {
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+      return false;
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(header_t)) {
+      ::close(fd);
+      CG_WARNING("GridHandler:load") << "Invalid grid cache file '" << filename << "'.";
+      return false;
+    }
+    const size_t size = st.st_size;
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // mapping remains valid after the descriptor is closed
+    if (addr == MAP_FAILED) {
+      CG_WARNING("GridHandler:load") << "Failed to map grid cache file '" << filename << "' into memory.";
+      return false;
+    }
+    std::shared_ptr<const char> mapping(static_cast<const char*>(addr),
+                                        [size](const char* ptr) { ::munmap(const_cast<char*>(ptr), size); });
+    const auto& header = *reinterpret_cast<const header_t*>(mapping.get());
+    if (header.magic != GOOD_MAGIC || header.version != VERSION || header.dim != D || header.num_values != N) {
+      CG_WARNING("GridHandler:load") << "Invalid grid cache file '" << filename << "'.";
+      return false;
+    }
+    if (header.key != key || header.grid_type != (unsigned short)grid_type_) {
+      CG_DEBUG("GridHandler:load") << "Grid cache file '" << filename << "' does not match the configuration.";
+      return false;
+    }
+    size_t num_coords = 0, num_nodes = 1;
+    for (const auto& nc : header.num_coords)
+      num_coords += nc, num_nodes *= nc;
+    if (size != sizeof(header_t) + num_coords * sizeof(double) + num_nodes * sizeof(values_t)) {
+      CG_WARNING("GridHandler:load") << "Truncated grid cache file '" << filename << "'.";
+      return false;
+    }
+    const auto* coords = reinterpret_cast<const double*>(mapping.get() + sizeof(header_t));
+    for (size_t i = 0; i < D; ++i) {
+      coords_[i].assign(coords, coords + header.num_coords[i]);
+      coords += header.num_coords[i];
+    }
+    computeStrides();
+    values_raw_.clear();
+    nodes_values_.clear();
+    nodes_ = reinterpret_cast<const values_t*>(coords);
+    mapping_ = std::move(mapping);
+    prepare();
+    CG_DEBUG("GridHandler:load") << "Grid with " << utils::s("node", num_nodes, true) << " mapped from '" << filename
+                                 << "'. Boundaries: " << boundaries() << ".";
+    return true;
+  }
+
+  template <size_t D, size_t N>
+  std::string GridHandler<D, N>::cachePath(const std::string& grid_path, size_t extra_key) {
+    return extra_key == 0 ? grid_path + ".cgcache" : utils::format("%s.%016zx.cgcache", grid_path.c_str(), extra_key);
+  }
+
+  template <size_t D, size_t N>
+  size_t GridHandler<D, N>::fileKey(const std::string& grid_path, size_t extra_key) {
+    std::ostringstream os;
+    os << fs::absolute(grid_path).string() << "|" << fs::file_size(grid_path) << "|"
+       << fs::last_write_time(grid_path).time_since_epoch().count() << "|" << D << "|" << N << "|" << extra_key;
+    return std::hash<std::string>()(os.str());
+  }
+
   template <size_t D, size_t N>
   std::array<Limits, D> GridHandler<D, N>::boundaries() const {
     std::array<Limits, D> out;
@@ -296,48 +471,38 @@ namespace cepgen {
   }
 
   template <size_t D, size_t N>
-  void GridHandler<D, N>::findIndices(const coord_t& coord, coord_t& min, coord_t& max) const {
-    for (size_t i = 0; i < D; ++i) {
-      const auto& c_i = coords_.at(i);   // extract all coordinates registered for this dimension
-      if (coord.at(i) < *c_i.begin()) {  // under the range
-        CG_DEBUG_LOOP("GridHandler:indices") << "Coordinate " << i << " in underflow range "
-                                             << "(" << coord.at(i) << " < " << *c_i.begin() << ").";
-        min[i] = max[i] = *c_i.begin();
-      } else if (coord.at(i) > *c_i.rbegin()) {  // over the range
-        CG_DEBUG_LOOP("GridHandler:indices") << "Coordinate " << i << " in overflow range "
-                                             << "(" << coord.at(i) << " > " << *c_i.rbegin() << ").";
-        min[i] = max[i] = *c_i.rbegin();
-      } else {  // in between two coordinates
-        auto it_coord = std::lower_bound(c_i.begin(), c_i.end(), coord.at(i));
-        max[i] = *it_coord;
-        if (it_coord != c_i.begin())
-          it_coord--;
-        min[i] = *it_coord;
-      }
+  void GridHandler<D, N>::locate(size_t dim, double coord, size_t& index, double& frac) const {
+    const auto& c_i = coords_[dim];  // extract all coordinates registered for this dimension
+    index = 0;
+    frac = 0.;
+    if (c_i.size() < 2 || coord <= c_i.front()) {  // under the range
+      CG_DEBUG_LOOP("GridHandler:indices") << "Coordinate " << dim << " in underflow range "
+                                           << "(" << coord << " <= " << c_i.front() << ").";
+      return;
     }
+    if (coord >= c_i.back()) {  // over the range
+      CG_DEBUG_LOOP("GridHandler:indices") << "Coordinate " << dim << " in overflow range "
+                                           << "(" << coord << " >= " << c_i.back() << ").";
+      index = c_i.size() - 1;
+      return;
+    }
+    // in between two coordinates
+    index = std::distance(c_i.begin(), std::upper_bound(c_i.begin(), c_i.end(), coord)) - 1;
+    frac = (coord - c_i[index]) / (c_i[index + 1] - c_i[index]);
   }
 
-  //----------------------------------------------------------------------------
-  // grid manipulation utility
-  //----------------------------------------------------------------------------
-
-  template <size_t D, size_t N>
-  typename GridHandler<D, N>::gridpoint_t GridHandler<D, N>::gridpoint_t::operator*(double c) const {
-    gridpoint_t out = *this;
-    std::transform(out.begin(), out.end(), out.begin(), [&c](const auto& a) { return a * c; });
-    return out;
-  }
-
-  template <size_t D, size_t N>
-  typename GridHandler<D, N>::gridpoint_t GridHandler<D, N>::gridpoint_t::operator+(const gridpoint_t& rhs) const {
-    gridpoint_t out = *this;
-    for (size_t i = 0; i < out.size(); ++i)
-      out[i] += rhs[i];
-    return out;
+  ParametersDescription gridTabulationDescription(int num_spot_checks, double tolerance) {
+    auto desc = ParametersDescription();
+    desc.add<int>("numSpotChecks", num_spot_checks).setDescription("number of exact evaluations to validate the table");
+    desc.add<double>("tolerance", tolerance).setDescription("maximal relative interpolation uncertainty");
+    desc.add<std::string>("gridPath", "")
+        .setDescription("path to a table file to reload (or to write if invalid or missing; disabled if empty)");
+    return desc;
   }
 
   template class GridHandler<1, 1>;
   template class GridHandler<1, 2>;
+  template class GridHandler<2, 1>;
   template class GridHandler<2, 2>;
   template class GridHandler<3, 1>;
 }  // namespace cepgen
@@ -23,45 +23,104 @@
 #include <gsl/gsl_spline.h>
 #include <gsl/gsl_version.h>
 #if defined(GSL_MAJOR_VERSION) && (GSL_MAJOR_VERSION > 2 || (GSL_MAJOR_VERSION == 2 && GSL_MINOR_VERSION >= 1))
-#include <gsl/gsl_interp2d.h>
-#include <gsl/gsl_spline2d.h>
 #define GSL_VERSION_ABOVE_2_1 1
 #endif
 
+#include <algorithm>
 #include <array>
+#include <functional>
 #include <map>
 #include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
 #include <vector>
 
+#include "CepGen/Core/Exception.h"
 #include "CepGen/Utils/Limits.h"
 
 namespace cepgen {
+  class ParametersDescription;
+  class ParametersList;
   /// Interpolation type for the grid coordinates
   enum struct GridType { linear, logarithmic, square };
+  /// Steering parameters for the tabulation of a function in a grid (see GridHandler::tabulate)
+  /// \param[in] num_spot_checks default number of exact evaluations to validate the table
+  /// \param[in] tolerance default maximal relative interpolation uncertainty
+  ParametersDescription gridTabulationDescription(int num_spot_checks, double tolerance);
   /// A generic class for \f$\mathbb{R}^D\mapsto\mathbb{R}^N\f$ grid interpolation
   /// \tparam D Number of variables in the grid (dimension)
   /// \tparam N Number of values handled per point
+  /// \note Once initialised, the grid is only read by eval(), which may thus be called from concurrent threads
+  /// \note Unless clamping is requested, coordinates outside the grid boundaries are evaluated to zero values
   template <size_t D, size_t N = 1>
   class GridHandler {
   public:
     typedef std::vector<double> coord_t;     ///< Coordinates container
+    typedef std::array<double, D> point_t;   ///< Fixed-size coordinates of a point to interpolate
     typedef std::array<double, N> values_t;  ///< Value(s) at a given coordinate
 
   public:
     /// Build a grid interpolator from a grid type
-    explicit GridHandler(const GridType& grid_type);
+    /// \param[in] grid_type interpolation type for the grid coordinates
+    /// \param[in] clamp evaluate the coordinates outside the grid at its closest boundary, instead of returning zero
+    explicit GridHandler(const GridType& grid_type, bool clamp = false);
     ~GridHandler() {}
 
     /// Interpolate a point to a given coordinate
-    values_t eval(coord_t in_coords) const;
+    values_t eval(point_t in_coords) const;
+    /// Interpolate a point to a given coordinate from any dynamic-size coordinates container
+    /// \note The container must hold exactly D coordinates
+    template <typename C, typename = decltype(std::declval<const C&>().size())>
+    inline values_t eval(const C& in_coords) const {
+      if (static_cast<size_t>(in_coords.size()) != D)
+        throw CG_FATAL("GridHandler") << "Invalid coordinates multiplicity: expected " << D << ", got "
+                                      << in_coords.size() << ".";
+      point_t coord{};
+      std::copy_n(std::begin(in_coords), D, coord.begin());
+      return eval(coord);
+    }
 
     /// Insert a new value in the grid
     void insert(coord_t coord, values_t value);
+    /// Fill the grid with the values of a function on all nodes (or retrieve it from its cache file), and validate it
+    /// \note The interpolation is validated against exact evaluations at the centre of a few grid cells
+    /// \param[in] nodes coordinates of the nodes along each axis
+    /// \param[in] func function to tabulate
+    /// \param[in] params tabulation parameters, as described by gridTabulationDescription()
+    /// \param[in] key hash of the configuration the grid is built for
+    /// \param[in] unmap optional transformation of the tabulated values prior to their validation
+    /// \return Maximal relative interpolation uncertainty, or nothing if the grid was retrieved from its cache file
+    std::optional<double> tabulate(const std::array<coord_t, D>& nodes,
+                                   const std::function<values_t(const point_t&)>& func,
+                                   const ParametersList& params,
+                                   size_t key,
+                                   const std::function<double(double)>& unmap = nullptr);
     /// Return the list of values handled in the grid
-    inline std::map<coord_t, values_t> values() const { return values_raw_; }
+    std::map<coord_t, values_t> values() const;
 
     /// Initialise the grid and all useful interpolators/accelerators
     void initialise();
+
+    /// Store the initialised grid nodes and values into a binary cache file
+    /// \note The file is written under a temporary name, then renamed, so that any live mapping of a previous
+    ///   version of the file (see load()) remains valid
+    /// \param[in] filename path to the cache file
+    /// \param[in] key hash of the configuration the grid was built for
+    /// \return True if the file was successfully written
+    bool save(const std::string& filename, size_t key) const;
+    /// Retrieve the grid nodes and values from a binary cache file, and initialise the grid
+    /// \note The file is memory-mapped and its content is used in place; it is hence shared among all processes
+    ///   interpolating the same grid
+    /// \param[in] filename path to the cache file
+    /// \param[in] key hash of the configuration the grid is expected to be built for
+    /// \return True if the file exists, is valid, and was built for the given configuration
+    bool load(const std::string& filename, size_t key);
+    /// Path to the binary cache file associated to an input grid file
+    /// \param[in] extra_key hash of the parsing configuration (if any), to keep distinct caches per configuration
+    static std::string cachePath(const std::string& grid_path, size_t extra_key = 0);
+    /// Hash identifying an input grid file (path, size, and last modification time) and its parsing configuration
+    static size_t fileKey(const std::string& grid_path, size_t extra_key = 0);
     /// Grid boundaries (collection of (min,max))
     std::array<Limits, D> boundaries() const;
     /// Lowest bound of the grid coordinates
@@ -72,32 +131,53 @@ namespace cepgen {
   protected:
     /// Type of interpolation for the grid members
     GridType grid_type_;
+    /// Are the coordinates outside the grid clamped to its boundaries?
+    bool clamp_;
     /// List of coordinates and associated value(s) in the grid
     std::map<coord_t, values_t> values_raw_;
-    /// GSL grid interpolation accelerator
-    std::vector<std::unique_ptr<gsl_interp_accel, void (*)(gsl_interp_accel*)> > accel_;
     /// Collection of splines for linear interpolations
     std::vector<std::unique_ptr<gsl_spline, void (*)(gsl_spline*)> > splines_1d_;
-#ifdef GSL_VERSION_ABOVE_2_1
-    /// Collection of splines for bilinear interpolations
-    std::vector<std::unique_ptr<gsl_spline2d, void (*)(gsl_spline2d*)> > splines_2d_;
-#endif
     /// Collection of coordinates building up the grid
     std::array<coord_t, D> coords_;
-    /// Collection of values for all points in the grid
+    /// Collection of values for all points in the grid (one-dimensional splines)
     std::array<std::unique_ptr<double[]>, N> values_;
+    /// Values for all nodes of the grid, stored contiguously with the last coordinate running fastest
+    std::vector<values_t> nodes_values_;
+    /// Offset between two consecutive nodes along each coordinate in the values collection
+    std::array<size_t, D> strides_{};
+    /// Values for all nodes of the grid, either from the collection above or from a memory-mapped cache file
+    const values_t* nodes_{nullptr};
+    /// Memory-mapped cache file content, if the grid was retrieved from it
+    std::shared_ptr<const char> mapping_;
 
   private:
-    /// Retrieve lower and upper grid indices for a given coordinate
-    void findIndices(const coord_t& coord, coord_t& min, coord_t& max) const;
-    /// A single value in grid coordinates
-    struct gridpoint_t : values_t {
-      gridpoint_t(const values_t& arr) : values_t(arr) {}
-      gridpoint_t operator*(double c) const;
-      gridpoint_t operator+(const gridpoint_t& rhs) const;
+    static constexpr unsigned int GOOD_MAGIC = 0x48474743;  ///< Magic number for binary grid cache files ("CGGH")
+    static constexpr unsigned short VERSION = 1;            ///< Binary grid cache file format version
+    /// Binary grid cache file header
+    struct header_t {
+      unsigned int magic;                            ///< File magic number
+      unsigned short version;                        ///< File format version
+      unsigned short dim, num_values, grid_type;     ///< Grid dimension, values multiplicity, coordinates type
+      unsigned long long key;                        ///< Hash of the configuration the grid was built for
+      std::array<unsigned long long, D> num_coords;  ///< Number of nodes along each coordinate
     };
+    /// Compute the strides and total number of nodes from the grid coordinates
+    size_t computeStrides();
+    /// Finalise the grid initialisation once the nodes values are set
+    void prepare();
+    /// Is a (grid) coordinate outside the grid boundaries along one axis?
+    bool outOfRange(size_t dim, double coord) const;
+    /// Retrieve the lower node index and the relative position in its cell for one coordinate
+    /// \note Coordinates outside the grid are clamped to its boundaries
+    void locate(size_t dim, double coord, size_t& index, double& frac) const;
+    /// Multilinear interpolation of the grid nodes values
+    values_t interpolate(const point_t& coord) const;
+    /// Convert a grid coordinate back to its physical value
+    double fromGridCoordinate(double coord) const;
     /// Has the extrapolator been initialised?
     bool init_{false};
+    /// Unique identifier of the initialised grid content, to match the per-thread spline accelerator to its grid
+    size_t accel_id_{0};
   };
 }  // namespace cepgen
 
@@ -16,15 +16,27 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <thread>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Core/GeneratorWorker.h"
 #include "CepGen/Core/RunParameters.h"
+#include "CepGen/EventFilter/EventModifier.h"
 #include "CepGen/Integration/GridParameters.h"
 #include "CepGen/Integration/Integrator.h"
 #include "CepGen/Integration/ProcessIntegrand.h"
 #include "CepGen/Modules/GeneratorWorkerFactory.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
 #include "CepGen/Process/Process.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Functional.h"
 #include "CepGen/Utils/ProgressBar.h"
+#include "CepGen/Utils/RandomGenerator.h"
 #include "CepGen/Utils/String.h"
 #include "CepGen/Utils/TimeKeeper.h"
 
@@ -32,15 +44,27 @@ namespace cepgen {
   class GridOptimisedGeneratorWorker final : public GeneratorWorker {
   public:
     /// Book the memory slots and structures for the generator
-    explicit GridOptimisedGeneratorWorker(const ParametersList& params) : GeneratorWorker(params) {}
+    explicit GridOptimisedGeneratorWorker(const ParametersList& params)
+        : GeneratorWorker(params),
+          alias_sampling_(steer<bool>("aliasSampling")),
+          rnd_([this]() { return uniform(); }) {}
+    ~GridOptimisedGeneratorWorker() override;
 
     void initialise() override;
+    void initialiseFrom(const GeneratorWorker&) override;
+    bool threadSafe() const override { return true; }
     bool next() override;
 
     static ParametersDescription description() {
       auto desc = GeneratorWorker::description();
       desc.setDescription("Grid-optimised worker");
       desc.add<int>("binSize", 3);
+      desc.add<std::string>("gridCache", "")
+          .setDescription("directory where prepared grids are stored and retrieved (disabled if empty)");
+      desc.add<bool>("aliasSampling", false)
+          .setDescription(
+              "select the bins proportionally to their function maximum (alias method) instead of uniformly, "
+              "to avoid most of the trials being rejected before the function evaluation");
       return desc;
     }
 
@@ -52,24 +76,116 @@ namespace cepgen {
     bool correctionCycle(bool&);
     /// Prepare the object for event generation
     void computeGenerationParameters();
+    /// Hash of the run configuration (process, kinematics, integrator state, grid) the grid is prepared for
+    size_t configurationHash() const;
+    /// Select a bin and a function value threshold for the next trial
+    /// \return Function value threshold, to be compared to the bin maximum and to the weight of the point
+    double selectBin();
+
+    /// Walker alias table for the selection of bins proportionally to their function maximum
+    class AliasTable {
+    public:
+      /// Build the table from the grid bins maxima
+      void build(const GridParameters&);
+      /// Draw a bin index from two uniform random numbers in [0, 1)
+      size_t sample(double, double) const;
+      /// Sum of all bins maxima the table was built from
+      double total() const { return total_; }
+
+    private:
+      std::vector<double> prob_;   ///< Probability to keep the drawn bin
+      std::vector<size_t> alias_;  ///< Alternative bin if the drawn one is not kept
+      double total_{0.};
+    };
 
     /// Set of parameters for the integration/event generation grid
     std::unique_ptr<GridParameters> grid_;
     /// Selected bin at which the function will be evaluated
-    int ps_bin_{UNASSIGNED_BIN};  ///< Last bin to be corrected
-    std::vector<double> coords_;  ///< Phase space coordinates being evaluated
+    int ps_bin_{UNASSIGNED_BIN};         ///< Last bin to be corrected
+    std::vector<double> coords_;         ///< Phase space coordinates being evaluated
+    const bool alias_sampling_;          ///< Select the bins proportionally to their function maximum?
+    AliasTable alias_;                   ///< Bins selection table for the alias sampling
+    bool alias_outdated_{true};          ///< Has the grid been corrected since the last alias table build?
+    double num_trials_per_bin_{0.};      ///< Equivalent number of uniform trials per bin (alias sampling)
+    const std::function<double()> rnd_;  ///< Uniform random numbers generator for grid shooting
+
+    /// Unweighting efficiency bookkeeping
+    struct Statistics {
+      double num_trials{0.};      ///< Number of (uniform-equivalent) bin selection trials
+      size_t num_draws{0};        ///< Number of bin selections
+      size_t num_evaluations{0};  ///< Number of function evaluations
+      size_t num_accepted{0};     ///< Number of accepted events
+    } stats_;
   };
 
+  GridOptimisedGeneratorWorker::~GridOptimisedGeneratorWorker() {
+    if (stats_.num_accepted == 0)
+      return;
+    CG_INFO("GridOptimisedGeneratorWorker").log([&](auto& log) {
+      log << "Unweighting statistics (" << (alias_sampling_ ? "alias" : "uniform") << " bins sampling):\n\t"
+          << "bin selections: " << stats_.num_draws << " (equivalent uniform trials: " << (size_t)stats_.num_trials
+          << "), function evaluations: " << stats_.num_evaluations
+          << ", accepted events: " << stats_.num_accepted << ".\n\t"
+          << "Unweighting efficiency: " << (double)stats_.num_accepted / stats_.num_evaluations
+          << ", accepted events per bin selection: " << (double)stats_.num_accepted / stats_.num_draws << ".";
+    });
+  }
+
   void GridOptimisedGeneratorWorker::initialise() {
     grid_.reset(new GridParameters(steer<int>("binSize"), integrand_->size()));
     coords_ = std::vector<double>(integrand_->size());
-    if (!grid_->prepared())
+    std::string cache_file;
+    size_t cache_key = 0;
+    if (const auto& cache_path = steer<std::string>("gridCache"); !cache_path.empty()) {
+      cache_key = configurationHash();
+      cache_file = (fs::path(cache_path) / utils::format("cepgen_grid_%016zx.bin", cache_key)).string();
+      if (grid_->load(cache_file, cache_key)) {
+        integrand_->setStorage(true);
+        CG_INFO("GridOptimisedGeneratorWorker:initialise")
+            << "Prepared grid retrieved from '" << cache_file << "'. Now launching the unweighted event production.";
+      }
+    }
+    if (!grid_->prepared()) {
       computeGenerationParameters();
+      if (!cache_file.empty()) {
+        fs::create_directories(fs::path(cache_file).parent_path());
+        grid_->save(cache_file, cache_key);
+        CG_INFO("GridOptimisedGeneratorWorker:initialise") << "Prepared grid saved into '" << cache_file << "'.";
+      }
+    }
     CG_DEBUG("GridOptimisedGeneratorWorker:initialise")
         << "Dim-" << integrand_->size() << " " << integrator_->name() << " integrator "
         << "set for dim-" << grid_->n(0).size() << " grid.";
   }
 
+  void GridOptimisedGeneratorWorker::initialiseFrom(const GeneratorWorker& oth) {
+    const auto* worker = dynamic_cast<const GridOptimisedGeneratorWorker*>(&oth);
+    if (!worker || !worker->grid_ || !worker->grid_->prepared()) {
+      initialise();
+      return;
+    }
+    // copy the already prepared grid to skip the preparation stage
+    grid_.reset(new GridParameters(*worker->grid_));
+    coords_ = std::vector<double>(integrand_->size());
+    integrand_->setStorage(true);
+    CG_DEBUG("GridOptimisedGeneratorWorker:initialise")
+        << "Dim-" << integrand_->size() << " grid copied from an already prepared worker.";
+  }
+
+  size_t GridOptimisedGeneratorWorker::configurationHash() const {
+    std::ostringstream os;
+    os << integrand_->process().parameters().serialise() << "|"
+       << integrand_->process().kinematics().parameters(true).serialise() << "|"
+       << integrator_->parameters().serialise() << "|" << integrator_->stateHash() << "|" << steer<int>("binSize")
+       << "|" << params_->generation().numPoints();
+    // taming functions and event modification algorithms also alter the weights probed in the grid
+    for (const auto& tf : params_->tamingFunctions())
+      os << "|taming:" << tf->parameters().serialise();
+    for (const auto& mod : params_->eventModifiersSequence())
+      os << "|modifier:" << mod->parameters().serialise();
+    return std::hash<std::string>()(os.str());
+  }
+
   //-----------------------------------------------------------------------------------------------
   // events generation part
   //-----------------------------------------------------------------------------------------------
@@ -87,8 +203,11 @@ namespace cepgen {
       bool store = false;
       while (!correctionCycle(store)) {
       }
-      if (store)
+      alias_outdated_ = true;  // bins maxima may have been corrected
+      if (store) {
+        ++stats_.num_accepted;
         return storeEvent();
+      }
     }
 
     //--- normal generation cycle
@@ -98,30 +217,88 @@ namespace cepgen {
       double y = -1.;
       // select a function value and reject if fmax is too small
       do {
-        // ...
-        ps_bin_ = integrator_->uniform({0., (double)grid_->size()});
-        y = integrator_->uniform({0., grid_->globalMax()});
-        grid_->increment(ps_bin_);
+        y = selectBin();
       } while (y > grid_->maxValue(ps_bin_));
       // shoot a point x in this bin
-      grid_->shoot(integrator_, ps_bin_, coords_);
+      grid_->shoot(rnd_, ps_bin_, coords_);
       // get weight for selected x value
       weight = integrator_->eval(*integrand_, coords_);
+      ++stats_.num_evaluations;
       if (weight > y)
         break;
     }
 
-    if (weight > grid_->maxValue(ps_bin_))
+    if (weight > grid_->maxValue(ps_bin_)) {
       // if weight is higher than local or global maximum,
       // init correction cycle for the next event
       grid_->initCorrectionCycle(ps_bin_, weight);
-    else  // no grid correction needed for this bin
+      alias_outdated_ = true;
+    } else  // no grid correction needed for this bin
       ps_bin_ = UNASSIGNED_BIN;
 
     // return with an accepted event
+    ++stats_.num_accepted;
     return storeEvent();
   }
 
+  double GridOptimisedGeneratorWorker::selectBin() {
+    ++stats_.num_draws;
+    if (!alias_sampling_) {  // uniform bin selection, then rejection against the bin maximum
+      ps_bin_ = uniform({0., (double)grid_->size()});
+      grid_->increment(ps_bin_);
+      stats_.num_trials += 1.;
+      return uniform({0., grid_->globalMax()});
+    }
+    if (alias_outdated_) {
+      alias_.build(*grid_);
+      alias_outdated_ = false;
+    }
+    // bins are drawn proportionally to their maximum; the threshold is then uniform below this maximum,
+    // reproducing the joint (bin, threshold) distribution of the uniform selection without its rejections
+    ps_bin_ = alias_.sample(uniform(), uniform());
+    // each draw stands for (global max / sum of maxima) uniform trials in every bin, on average
+    const auto num_equiv_trials = grid_->globalMax() / alias_.total();
+    num_trials_per_bin_ += num_equiv_trials;
+    stats_.num_trials += num_equiv_trials * grid_->size();
+    grid_->setNumPoints(ps_bin_, num_trials_per_bin_);  // exact (fractional) uniform-equivalent bookkeeping
+    return uniform({0., grid_->maxValue(ps_bin_)});
+  }
+
+  void GridOptimisedGeneratorWorker::AliasTable::build(const GridParameters& grid) {
+    const auto num_bins = grid.size();
+    total_ = 0.;
+    for (size_t i = 0; i < num_bins; ++i)
+      total_ += grid.maxValue(i);
+    if (total_ <= 0.)
+      throw CG_FATAL("GridOptimisedGeneratorWorker:AliasTable")
+          << "Cannot build the bins selection table from a grid with vanishing maxima.";
+    // Vose's construction of the alias table
+    prob_.assign(num_bins, 1.);
+    alias_.resize(num_bins);
+    std::vector<double> scaled(num_bins);
+    std::vector<size_t> small, large;
+    for (size_t i = 0; i < num_bins; ++i) {
+      alias_[i] = i;
+      scaled[i] = grid.maxValue(i) * num_bins / total_;
+      (scaled[i] < 1. ? small : large).emplace_back(i);
+    }
+    while (!small.empty() && !large.empty()) {
+      const auto less = small.back(), more = large.back();
+      small.pop_back();
+      large.pop_back();
+      prob_[less] = scaled[less];
+      alias_[less] = more;
+      scaled[more] = (scaled[more] + scaled[less]) - 1.;
+      (scaled[more] < 1. ? small : large).emplace_back(more);
+    }
+    // remaining entries (up to rounding) are kept with unit probability
+  }
+
+  size_t GridOptimisedGeneratorWorker::AliasTable::sample(double u1, double u2) const {
+    const auto bin = std::min<size_t>(u1 * prob_.size(), prob_.size() - 1);
+    return u2 < prob_[bin] ? bin : alias_[bin];
+  }
+
   bool GridOptimisedGeneratorWorker::correctionCycle(bool& store) {
     CG_TICKER(const_cast<RunParameters*>(params_)->timeKeeper());
 
@@ -133,15 +310,16 @@ namespace cepgen {
     if (grid_->correctionValue() >= 1.)
       grid_->setCorrectionValue(grid_->correctionValue() - 1.);
 
-    if (integrator_->uniform() < grid_->correctionValue()) {
+    if (uniform() < grid_->correctionValue()) {
       grid_->setCorrectionValue(-1.);
       // select x values in phase space bin
-      grid_->shoot(integrator_, ps_bin_, coords_);
+      grid_->shoot(rnd_, ps_bin_, coords_);
       const double weight = integrator_->eval(*integrand_, coords_);
+      ++stats_.num_evaluations;
       // parameter for correction of correction
       grid_->rescale(ps_bin_, weight);
       // accept event
-      if (weight >= integrator_->uniform({0., grid_->maxValueDiff()}) + grid_->maxHistValue()) {
+      if (weight >= uniform({0., grid_->maxValueDiff()}) + grid_->maxHistValue()) {
         store = true;
         return true;
       }
@@ -164,48 +342,116 @@ namespace cepgen {
 
     integrand_->setStorage(false);
 
+    const auto num_points = params_->generation().numPoints();
+    const auto num_threads =
+        std::max<size_t>(1, std::min<size_t>(params_->generation().numThreads(), grid_->size()));
     CG_INFO("GridOptimisedGeneratorWorker:setGen")
-        << "Preparing the grid (" << utils::s("point", params_->generation().numPoints(), true) << "/bin) "
-        << "for the generation of unweighted events.";
+        << "Preparing the grid (" << utils::s("point", num_points, true) << "/bin) "
+        << "for the generation of unweighted events (" << utils::s("thread", num_threads, true) << ").";
 
-    const double inv_num_points = 1. / params_->generation().numPoints();
-    std::vector<double> point_coord(integrand_->size(), 0.);
-    if (point_coord.size() < grid_->n(0).size())
+    const double inv_num_points = 1. / num_points;
+    if (integrand_->size() < grid_->n(0).size())
       throw CG_FATAL("GridParameters:shoot") << "Coordinates vector multiplicity is insufficient!";
 
-    // ...
-    double sum = 0., sum2 = 0., sum2p = 0.;
-
+    // each bin is probed with its own random streams (for both the grid shooting, using the integrator random
+    // number engine, and the process-local randomisation), so that the grid is identical whatever the number of
+    // threads used
+    const auto seed = integrator_->seed();
+    const auto shoot_rnd_params = integrator_->parameters().get<ParametersList>("randomGenerator");
+    const auto proc_rnd_params = integrand_->process().parameters().get<ParametersList>("randomGenerator");
+
+    struct BinSummary {
+      double av{0.}, av2{0.}, fmax{0.};
+    };
+    std::vector<BinSummary> bins(grid_->size());
+    std::atomic<size_t> next_bin{0};
+    size_t num_done{0};
+    std::mutex prog_bar_mutex;  // the progress bar is not thread-safe
     utils::ProgressBar prog_bar(grid_->size(), 5);
 
-    //--- main loop
-    for (unsigned int i = 0; i < grid_->size(); ++i) {
-      double fsum = 0., fsum2 = 0.;
-      for (size_t j = 0; j < params_->generation().numPoints(); ++j) {
-        grid_->shoot(integrator_, i, point_coord);
-        const double weight = integrator_->eval(*integrand_, point_coord);
-        grid_->setValue(i, weight);
-        fsum += weight;
-        fsum2 += weight * weight;
+    auto probe_bins = [&](ProcessIntegrand& integrand, std::exception_ptr& exc) {
+      // the integrand-local process random stream is overridden for each bin; restore it once the grid is prepared
+      std::unique_ptr<utils::RandomGenerator> original_rnd_gen;
+      try {
+        std::vector<double> point_coord(integrand.size(), 0.);
+        // one engine per thread for each stream, reseeded for each bin
+        auto shoot_rnd = RandomGeneratorFactory::get().build(shoot_rnd_params);
+        const std::function<double()> rnd = [&shoot_rnd]() { return shoot_rnd->uniform(); };
+        auto proc_rnd_owned = RandomGeneratorFactory::get().build(proc_rnd_params);
+        auto* proc_rnd = proc_rnd_owned.get();
+        original_rnd_gen = integrand.process().setRandomGenerator(std::move(proc_rnd_owned));
+        // independent streams (0: grid shooting, 1: process-local randomisation) for each bin, decorrelated
+        // from the streams of the generation workers
+        const auto stream_seed = [&seed](size_t bin, unsigned int stream) {
+          std::seed_seq seq{(unsigned int)(seed & 0xffffffff), (unsigned int)(seed >> 32), (unsigned int)bin, stream};
+          std::array<unsigned int, 2> seeds;
+          seq.generate(seeds.begin(), seeds.end());
+          return ((unsigned long long)seeds[0] << 32) | seeds[1];
+        };
+        for (size_t i = next_bin++; i < grid_->size(); i = next_bin++) {
+          shoot_rnd->setSeed(stream_seed(i, 0u));
+          proc_rnd->setSeed(stream_seed(i, 1u));
+          auto& bin = bins.at(i);
+          double fsum = 0., fsum2 = 0.;
+          for (size_t j = 0; j < num_points; ++j) {
+            grid_->shoot(rnd, i, point_coord);
+            const double weight = integrator_->eval(integrand, point_coord);
+            bin.fmax = std::max(bin.fmax, weight);
+            fsum += weight;
+            fsum2 += weight * weight;
+          }
+          bin.av = fsum * inv_num_points;
+          bin.av2 = fsum2 * inv_num_points;
+          std::lock_guard<std::mutex> lock(prog_bar_mutex);
+          prog_bar.update(++num_done);
+        }
+      } catch (...) {
+        exc = std::current_exception();
+        next_bin = grid_->size();  // stop all other threads
       }
-      const double av = fsum * inv_num_points, av2 = fsum2 * inv_num_points;
-      const double sig2 = av2 - av * av;
-      sum += av;
-      sum2 += av2;
+      if (original_rnd_gen)
+        integrand.process().setRandomGenerator(std::move(original_rnd_gen));
+    };
+
+    //--- main loop (the calling thread handles its share of bins with the worker-local integrand)
+    std::vector<std::unique_ptr<ProcessIntegrand> > integrands;
+    for (size_t i = 1; i < num_threads; ++i) {
+      integrands.emplace_back(new ProcessIntegrand(params_));
+      integrands.back()->cloneRunModules(i);
+      integrands.back()->setStorage(false);
+    }
+    std::vector<std::exception_ptr> exceptions(num_threads);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; ++i)
+      threads.emplace_back(probe_bins, std::ref(*integrands.at(i - 1)), std::ref(exceptions.at(i)));
+    probe_bins(*integrand_, exceptions.at(0));
+    for (auto& thread : threads)
+      thread.join();
+    for (const auto& exc : exceptions)
+      if (exc)
+        std::rethrow_exception(exc);
+
+    //--- deterministic (ordered) reduction of all per-bin quantities
+    double sum = 0., sum2 = 0., sum2p = 0.;
+    for (size_t i = 0; i < grid_->size(); ++i) {
+      const auto& bin = bins.at(i);
+      grid_->setValue(i, bin.fmax);
+      const double sig2 = bin.av2 - bin.av * bin.av;
+      sum += bin.av;
+      sum2 += bin.av2;
       sum2p += sig2;
 
       // per-bin debugging loop
       CG_DEBUG_LOOP("GridOptimisedGeneratorWorker:setGen").log([&](auto& dbg) {
         const double sig = sqrt(sig2);
-        const double eff = (grid_->maxValue(i) != 0.) ? av / grid_->maxValue(i) : 0.;
+        const double eff = (grid_->maxValue(i) != 0.) ? bin.av / grid_->maxValue(i) : 0.;
         dbg << "n-vector for bin " << i << ": " << utils::repr(grid_->n(i)) << "\n\t"
-            << "av   = " << av << "\n\t"
+            << "av   = " << bin.av << "\n\t"
             << "sig  = " << sig << "\n\t"
             << "fmax = " << grid_->maxValue(i) << "\n\t"
             << "eff  = " << eff;
       });
-      prog_bar.update(i + 1);
-    }  // end of main loop
+    }  // end of reduction loop
 
     const double inv_max = 1. / grid_->size();
     sum *= inv_max;
@@ -36,6 +36,7 @@ namespace cepgen {
 
     void Logger::addExceptionRule(const std::string& rule) {
       allowed_exc_.emplace_back(rule, std::regex_constants::extended);
+      ++configuration_;
     }
 
     bool Logger::passExceptionRule(const std::string& tmpl, const Level& lev) const {
@@ -19,6 +19,7 @@
 #ifndef CepGen_Utils_Logger_h
 #define CepGen_Utils_Logger_h
 
+#include <atomic>
 #include <regex>
 #include <vector>
 
@@ -49,7 +50,30 @@ namespace cepgen {
       /// Logging threshold
       Level level() const { return level_; }
       /// Set the logging threshold
-      void setLevel(Level level) { level_ = level; }
+      void setLevel(Level level) {
+        level_ = level;
+        ++configuration_;
+      }
+      /// Configuration revision, incremented whenever the logging threshold or rules are modified
+      unsigned long long configuration() const { return configuration_; }
+
+      /// Per-call site cache of the logging decision for a module and verbosity level
+      class CallSiteCache {
+      public:
+        /// Is the module set to be displayed/logged at this call site?
+        inline bool pass(const char* mod, const Level& lev) {
+          const auto& log = Logger::get();
+          if (const auto conf = log.configuration(); conf != configuration_) {  // logger was reconfigured
+            pass_ = log.passExceptionRule(mod, lev);
+            configuration_ = conf;
+          }
+          return pass_;
+        }
+
+      private:
+        unsigned long long configuration_{~0ull};
+        bool pass_{false};
+      };
       /// Also show extended information?
       bool extended() const { return extended_; }
       /// Set the extended information flag
@@ -72,6 +96,8 @@ namespace cepgen {
       bool extended_{false};
       /// Logging threshold for the output stream
       Level level_{Level::information};
+      /// Revision of the logging threshold and rules configuration
+      std::atomic<unsigned long long> configuration_{0ull};
       /// Output stream to use for all logging operations
       StreamHandler output_{nullptr};
     };
@@ -80,6 +106,13 @@ namespace cepgen {
 }  // namespace cepgen
 
 #define CG_LOG_MATCH(str, type) cepgen::utils::Logger::get().passExceptionRule(str, cepgen::utils::Logger::Level::type)
+/// Logging decision for a module, cached at the call site until the logger configuration is modified
+/// \note The module name is expected to be a constant expression for a given call site
+#define CG_LOG_MATCH_CACHED(str, type)                          \
+  [](const char* mod) {                                         \
+    thread_local cepgen::utils::Logger::CallSiteCache cache;    \
+    return cache.pass(mod, cepgen::utils::Logger::Level::type); \
+  }(str)
 #define CG_LOG_LEVEL(type) cepgen::utils::Logger::get().setLevel(cepgen::utils::Logger::Level::type)
 
 #endif
@@ -219,10 +219,15 @@ namespace cepgen {
   (!CG_LOG_MATCH(mod, debug)) \
       ? cepgen::NullStream()  \
       : cepgen::LoggedMessage(mod, __FUNC__, cepgen::LoggedMessage::MessageType::debug, __FILE__, __LINE__)
-#define CG_DEBUG_LOOP(mod)              \
-  (!CG_LOG_MATCH(mod, debugInsideLoop)) \
-      ? cepgen::NullStream()            \
+#ifdef CEPGEN_STRIP_LOOP_DEBUG  // loop-level debugging messages stripped at compile time
+// streamed operands bind to the (never evaluated) second branch, as for the run-time filtered macros
+#define CG_DEBUG_LOOP(mod) true ? cepgen::NullStream() : cepgen::NullStream()
+#else
+#define CG_DEBUG_LOOP(mod)                     \
+  (!CG_LOG_MATCH_CACHED(mod, debugInsideLoop)) \
+      ? cepgen::NullStream()                   \
       : cepgen::LoggedMessage(mod, __FUNC__, cepgen::LoggedMessage::MessageType::debug, __FILE__, __LINE__)
+#endif
 #define CG_WARNING(mod)         \
   (!CG_LOG_MATCH(mod, warning)) \
       ? cepgen::NullStream()    \
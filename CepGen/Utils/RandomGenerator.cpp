@@ -30,6 +30,10 @@ namespace cepgen {
       return 0.;
     }
 
+    void RandomGenerator::setSeed(unsigned long long) {
+      throw CG_FATAL("RandomGenerator:setSeed") << "Reseeding is not implemented for this random generator.";
+    }
+
     void* RandomGenerator::enginePtr() {
       throw CG_FATAL("RandomGenerator:enginePtr") << "No engine object declared for this random generator.";
     }
@@ -45,6 +45,9 @@ namespace cepgen {
       // specialised distributions
       virtual double exponential(double exponent = 1.);
 
+      /// Reset the engine state from a new seed
+      virtual void setSeed(unsigned long long);
+
       /// Retrieve the engine object
       template <typename T>
       T* engine() {
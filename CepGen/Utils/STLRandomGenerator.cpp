@@ -67,6 +67,7 @@ namespace cepgen {
     double uniform(double min, double max) override { return gen_->uniform(min, max); }
     double normal(double mean, double rms) override { return gen_->normal(mean, rms); }
     double exponential(double exponent) override { return gen_->exponential(exponent); }
+    void setSeed(unsigned long long seed) override { gen_->setSeed(seed_ = seed); }
 
   private:
     template <typename T>
@@ -77,6 +78,7 @@ namespace cepgen {
       double uniform(double min, double max) override { return std::uniform_real_distribution<>(min, max)(rng_); }
       double normal(double mean, double rms) override { return std::normal_distribution<>(mean, rms)(rng_); }
       double exponential(double exponent) override { return std::exponential_distribution<>(exponent)(rng_); }
+      void setSeed(unsigned long long seed) override { rng_.seed(seed_ = seed); }
 
     private:
       T rng_;
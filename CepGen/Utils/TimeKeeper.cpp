@@ -25,11 +25,13 @@
 namespace cepgen {
   namespace utils {
     void TimeKeeper::clear() {
+      std::lock_guard<std::mutex> lock(mutex_);
       monitors_.clear();
       tmr_.reset();
     }
 
     TimeKeeper& TimeKeeper::tick(const std::string& func, double time) {
+      std::lock_guard<std::mutex> lock(mutex_);
       monitors_[func].emplace_back(time > 0. ? time : tmr_.elapsed());
       return *this;
     }
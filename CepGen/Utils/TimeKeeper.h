@@ -19,6 +19,7 @@
 #ifndef CepGen_Utils_TimeKeeper_h
 #define CepGen_Utils_TimeKeeper_h
 
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -62,6 +63,7 @@ namespace cepgen {
     private:
       std::unordered_map<std::string, std::vector<float> > monitors_;
       Timer tmr_;
+      std::mutex mutex_;  ///< Protection against concurrent ticks from multiple threads
     };
   }  // namespace utils
 }  // namespace cepgen
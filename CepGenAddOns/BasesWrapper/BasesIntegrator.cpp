@@ -78,7 +78,7 @@ namespace cepgen {
     static double integrand_bases(double in[]) {
       if (!gIntegrand)
         throw CG_FATAL("BasesIntegrator") << "Integrand was not specified before integration.";
-      return gIntegrand->eval(std::vector<double>(in, in + gIntegrand->size()));
+      return gIntegrand->eval(in);
     }
   };
   Integrand* BasesIntegrator::gIntegrand = nullptr;
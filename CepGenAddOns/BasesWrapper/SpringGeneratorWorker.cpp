@@ -76,7 +76,7 @@ namespace cepgen {
     static double integrand_call(double in[]) {
       if (!gIntegrand)
         throw CG_FATAL("SpringGeneratorWorker") << "Integrand was not specified before event generation.";
-      return gIntegrand->eval(std::vector<double>(in, in + gIntegrand->size()));
+      return gIntegrand->eval(in);
     }
 
     const int max_trials_;
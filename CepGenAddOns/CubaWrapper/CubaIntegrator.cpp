@@ -16,25 +16,59 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cuba.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
 #include "CepGen/Core/Exception.h"
-#include "CepGen/Integration/Integrand.h"
+#include "CepGen/Integration/ProcessIntegrand.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Process/Process.h"
 #include "CepGenAddOns/CubaWrapper/CubaIntegrator.h"
 
 namespace cepgen {
   Integrand* CubaIntegrator::gIntegrand = nullptr;
 
+  namespace {
+    pid_t gMasterPid = 0;                         ///< identifier of the process steering the integration
+    unsigned long long gWorkerSeed = 0ull;        ///< base seed for the workers' process-local randomisation
+    std::unique_ptr<Integrand> gWorkerIntegrand;  ///< worker-local copy of the integrand
+  }  // namespace
+
   CubaIntegrator::CubaIntegrator(const ParametersList& params)
       : Integrator(params),
         ncomp_(steer<int>("ncomp")),
         nvec_(steer<int>("nvec")),
-        epsrel_(steer<double>("epsrel")),
+        epsrel_(precisionDriven() ? target_precision_ : steer<double>("epsrel")),
         epsabs_(steer<double>("epsabs")),
         mineval_(steer<int>("mineval")),
         maxeval_(steer<int>("maxeval")),
-        verbose_(steer<int>("verbose")) {}
+        verbose_(steer<int>("verbose")),
+        num_cores_(steer<int>("numCores")),
+        core_batch_(steer<int>("coreBatch")) {
+    if (nvec_ < 1)
+      throw CG_FATAL("CubaIntegrator") << "Invalid number of samples per integrand call: nvec=" << nvec_ << ".";
+    if (core_batch_ < 1)
+      throw CG_FATAL("CubaIntegrator") << "Invalid number of points per worker batch: coreBatch=" << core_batch_
+                                       << ".";
+    if (max_wall_time_ > 0.)
+      CG_WARNING("CubaIntegrator") << "Wall time limit is not supported by the Cuba algorithms and will be ignored. "
+                                   << "Use the 'maxeval' parameter to bound the integration.";
+  }
 
   Value CubaIntegrator::integrate(Integrand& integr) {
     gIntegrand = &integr;
+    gMasterPid = getpid();
+    gWorkerSeed = rnd_gen_->parameters().get<unsigned long long>("seed");
+    if (num_cores_ >= 0)
+      cubacores(&num_cores_, &core_batch_);
+    // workers are forked from the master process; they each build their own integrand copy at start-up
+    setCubaHook(cubainit, cuba_worker_init);
+    setCubaHook(cubaexit, cuba_worker_exit);
     return integrate();
   }
 
@@ -43,19 +77,62 @@ namespace cepgen {
     desc.setDescription("Cuba generic integration algorithm");
     desc.add<int>("ncomp", 1).setDescription("number of components of the integrand");
     desc.add<int>("nvec", 1).setDescription("number of samples received by the integrand");
-    desc.add<double>("epsrel", 1.e-3).setDescription("requested relative accuracy");
+    desc.add<double>("epsrel", 1.e-3).setDescription("requested relative accuracy (superseded by targetPrecision)");
     desc.add<double>("epsabs", 1.e-12).setDescription("requested absolute accuracy");
     desc.add<int>("mineval", 0).setDescription("minimum number of integrand evaluations required");
     desc.add<int>("maxeval", 50'000).setDescription("(approximate) maximum number of integrand evaluations allowed");
     desc.add<int>("verbose", 0);
+    desc.add<int>("numCores", -1).setDescription(
+        "number of worker processes forked for the sampling (0 = serial, <0 = Cuba's default, steered by the "
+        "CUBACORES environment variable)");
+    desc.add<int>("coreBatch", 1000).setDescription(
+        "maximum number of points dispatched to a worker at once (lower values balance the load of the small "
+        "per-region samples of Cuhre and Divonne over more workers; only used if numCores >= 0)");
     return desc;
   }
 
-  int cuba_integrand(const int* ndim, const double xx[], const int* /*ncomp*/, double ff[], void* /*userdata*/) {
-    if (!CubaIntegrator::gIntegrand)
+  int cuba_integrand(const int* ndim,
+                     const double xx[],
+                     const int* ncomp,
+                     double ff[],
+                     void* /*userdata*/,
+                     const int* nvec,
+                     const int* /*core*/) {
+    auto* integrand = gWorkerIntegrand ? gWorkerIntegrand.get() : CubaIntegrator::gIntegrand;
+    if (!integrand)
       throw CG_FATAL("cuba_integrand") << "Integrand not set for the Cuba algorithm!";
     //TODO: handle the non-[0,1] ranges
-    ff[0] = CubaIntegrator::gIntegrand->eval(std::vector<double>(xx, xx + *ndim));
+    if (*ncomp == 1)  // points and integrand values are both contiguous
+      integrand->evalBatch(xx, *nvec, ff);
+    else
+      for (int i = 0; i < *nvec; ++i) {
+        ff[i * *ncomp] = integrand->eval(xx + i * *ndim);
+        std::fill(ff + i * *ncomp + 1, ff + (i + 1) * *ncomp, 0.);
+      }
     return 0;
   }
+
+  void cuba_worker_init(void*, const int* core) {
+    if (getpid() == gMasterPid || !CubaIntegrator::gIntegrand)  // the master keeps evaluating the original integrand
+      return;
+    gWorkerIntegrand = CubaIntegrator::gIntegrand->clone();
+    if (!gWorkerIntegrand) {
+      CG_WARNING("cuba_worker_init") << "Integrand cannot be cloned. Worker will use its forked copy of the integrand.";
+      return;
+    }
+    // decorrelate the process-local random streams of all workers
+    if (auto* proc_integrand = dynamic_cast<ProcessIntegrand*>(gWorkerIntegrand.get()); proc_integrand) {
+      std::seed_seq seq{(unsigned int)(gWorkerSeed & 0xffffffff),
+                        (unsigned int)(gWorkerSeed >> 32),
+                        (unsigned int)(core ? *core + 1 : 0)};
+      std::vector<unsigned int> seed(2);
+      seq.generate(seed.begin(), seed.end());
+      auto rnd_params = proc_integrand->process().parameters().get<ParametersList>("randomGenerator");
+      rnd_params.set<unsigned long long>("seed", ((unsigned long long)seed.at(0) << 32) | seed.at(1));
+      proc_integrand->process().setRandomGenerator(RandomGeneratorFactory::get().build(rnd_params));
+    }
+    CG_DEBUG("cuba_worker_init") << "Worker " << (core ? *core : -1) << " built its own copy of the integrand.";
+  }
+
+  void cuba_worker_exit(void*, const int*) { gWorkerIntegrand.reset(); }
 }  // namespace cepgen
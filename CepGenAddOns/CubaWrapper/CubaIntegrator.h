@@ -40,9 +40,33 @@ namespace cepgen {
     double epsrel_, epsabs_;
     int mineval_, maxeval_;
     int verbose_;
+    int num_cores_;   ///< number of worker processes forked by Cuba (<0 for Cuba's default)
+    int core_batch_;  ///< maximum number of points dispatched to a worker at once
   };
 
-  int cuba_integrand(const int* ndim, const double xx[], const int* /*ncomp*/, double ff[], void* /*userdata*/);
+  /// Cuba integrand wrapper, evaluating batches of nvec points at once
+  int cuba_integrand(const int* ndim,
+                     const double xx[],
+                     const int* ncomp,
+                     double ff[],
+                     void* /*userdata*/,
+                     const int* nvec,
+                     const int* /*core*/);
+  /// Cuba worker start-up hook, building a worker-local copy of the integrand
+  void cuba_worker_init(void* /*arg*/, const int* core);
+  /// Cuba worker shut-down hook, releasing the worker-local copy of the integrand
+  void cuba_worker_exit(void* /*arg*/, const int* /*core*/);
+  /// Cuba integrand wrapper, cast to the five-arguments footprint expected by the Cuba algorithms
+  template <typename F>
+  inline F cubaIntegrand() {
+    return reinterpret_cast<F>(reinterpret_cast<void (*)()>(cuba_integrand));
+  }
+  /// Register a worker start-up/shut-down hook, cast to the (unprototyped) footprint expected by the Cuba
+  /// cubainit/cubaexit setters
+  template <typename F>
+  inline void setCubaHook(void (*setter)(F, void*), void (*hook)(void*, const int*)) {
+    setter(reinterpret_cast<F>(reinterpret_cast<void (*)()>(hook)), nullptr);
+  }
 }  // namespace cepgen
 
 #endif
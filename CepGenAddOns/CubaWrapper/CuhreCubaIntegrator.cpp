@@ -49,7 +49,7 @@ namespace cepgen {
 
       Cuhre(gIntegrand->size(),
             ncomp_,
-            cuba_integrand,
+            cubaIntegrand<integrand_t>(),
             nullptr,
             nvec_,
             epsrel_,
@@ -79,7 +79,7 @@ namespace cepgen {
 
       Divonne(gIntegrand->size(),
               ncomp_,
-              cuba_integrand,
+              cubaIntegrand<integrand_t>(),
               nullptr,
               nvec_,
               epsrel_,
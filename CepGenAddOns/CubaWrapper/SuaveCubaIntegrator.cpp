@@ -51,7 +51,7 @@ namespace cepgen {
 
       Suave(gIntegrand->size(),
             ncomp_,
-            cuba_integrand,
+            cubaIntegrand<integrand_t>(),
             nullptr,
             nvec_,
             epsrel_,
@@ -52,7 +52,7 @@ namespace cepgen {
 
       Vegas(gIntegrand->size(),
             ncomp_,
-            cuba_integrand,
+            cubaIntegrand<integrand_t>(),
             nullptr,
             nvec_,
             epsrel_,
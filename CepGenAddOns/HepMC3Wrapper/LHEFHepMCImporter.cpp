@@ -89,13 +89,13 @@ namespace cepgen {
           part.addMother(evt[moth.first - 1]);
         if (moth.second > 0)
           part.addMother(evt[moth.second - 1]);
-        if (utils::contains(part.mothers(), id_ip1)) {
+        if (part.mothers().count(id_ip1) > 0) {
           if (evt[Particle::Role::OutgoingBeam1].empty() && hepeup.IDUP.at(i) == (long)pdg_ip1)
             part.setRole(Particle::Role::OutgoingBeam1);
           else
             part.setRole(Particle::Role::Parton1);
         }
-        if (utils::contains(part.mothers(), id_ip2)) {
+        if (part.mothers().count(id_ip2) > 0) {
           if (evt[Particle::Role::OutgoingBeam2].empty() && hepeup.IDUP.at(i) == (long)pdg_ip2)
             part.setRole(Particle::Role::OutgoingBeam2);
           else
@@ -16,6 +16,9 @@
  *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <atomic>
+#include <thread>
+
 #include "CepGen/Core/Exception.h"
 #include "CepGen/Integration/Integrand.h"
 #include "CepGen/Integration/Integrator.h"
@@ -29,7 +32,10 @@ namespace cepgen {
   class PythonIntegrator final : public Integrator {
   public:
     explicit PythonIntegrator(const ParametersList& params)
-        : Integrator(params), env_(ParametersList().setName<std::string>("python_integrator")) {
+        : Integrator(params),
+          env_(ParametersList().setName<std::string>("python_integrator")),
+          num_threads_(steer<int>("numThreads") > 0 ? steer<int>("numThreads")
+                                                    : std::max(1u, std::thread::hardware_concurrency())) {
       auto cfg = python::ObjectPtr::importModule(steer<std::string>("module"));
       if (!cfg)
         throw PY_ERROR << "Failed to import the Python module '" << steer<std::string>("module") << "'.";
@@ -40,7 +46,28 @@ namespace cepgen {
     void setLimits(const std::vector<Limits>& lims) override { lims_ = python::ObjectPtr::make(lims); }
 
     Value integrate(Integrand& integrand) override {
+      if (auto no_owner = std::thread::id(); !gOwner.compare_exchange_strong(no_owner, std::this_thread::get_id()))
+        throw CG_FATAL("PythonIntegrator") << "Another Python integration is already running. "
+                                           << "Only one integration may run at a time in a given process.";
+      struct IntegrandReset {  // integrand and copies are only referenced for the duration of this integration
+        ~IntegrandReset() {
+          gClones.clear();
+          gIntegrand = nullptr;
+          gOwner = std::thread::id();
+        }
+      } reset_integrand;
       gIntegrand = &integrand;
+      gClones.clear();
+      for (size_t i = 1; i < num_threads_; ++i) {  // integrand copies for the concurrent evaluation of batches
+        auto clone = integrand.clone();
+        if (!clone) {
+          CG_WARNING("PythonIntegrator")
+              << "Integrand cannot be cloned for concurrent evaluations. Batches will be evaluated sequentially.";
+          gClones.clear();
+          break;
+        }
+        gClones.emplace_back(std::move(clone));
+      }
       const auto iterations = steer<int>("iterations");
       const auto evals = steer<int>("evals");
       PyMethodDef py_integr = {"integrand", py_integrand, METH_VARARGS, "A python-wrapped integrand"};
@@ -65,21 +92,156 @@ namespace cepgen {
           .setDescription("name of the Python module embedding the integrate() function");
       desc.add<int>("iterations", 10);
       desc.add<int>("evals", 1000);
+      desc.add<int>("numThreads", 1).setDescription(
+          "number of concurrent threads evaluating the batches of points (0 = hardware concurrency)");
       return desc;
     }
+    /// Integrand currently integrated, and its copies for concurrent evaluations
+    /// \note These are only set and cleared by integrate(), and only read by the Python callback on the thread
+    ///   owning the integration (gOwner), with the GIL held. When the GIL is released in evalPoints(), each worker
+    ///   thread only evaluates its own copy; the owning thread is blocked until all workers joined.
     static Integrand* gIntegrand;
+    static std::vector<std::unique_ptr<Integrand> > gClones;
+    /// Thread having started the integration, and owning the integrands above
+    static std::atomic<std::thread::id> gOwner;
 
   private:
     python::Environment env_;
+    const size_t num_threads_;
     python::ObjectPtr func_{nullptr}, lims_{nullptr};
+    /// Python-side integrand, either evaluating a single point (flat list of coordinates, or 1D buffer),
+    /// or a batch of points (list of coordinates lists, or C-contiguous (N, ndim) buffer of doubles)
+    /// \note For buffer inputs, a writable output buffer of N doubles may be passed as a second argument
     static PyObject* py_integrand(PyObject* /*self*/, PyObject* args) {
       if (!gIntegrand)
         throw CG_FATAL("PythonIntegrator") << "Integrand was not initialised.";
-      const auto c_args = python::ObjectPtr::wrap(PyTuple_GetItem(args, 0)).vector<double>();
-      return python::ObjectPtr::make<double>(gIntegrand->eval(c_args)).release();
+      if (std::this_thread::get_id() != gOwner)
+        throw CG_FATAL("PythonIntegrator") << "Integrand may only be evaluated from the thread owning the integration.";
+      auto* py_coords = PyTuple_GetItem(args, 0) /* borrowed */;
+      if (PyObject_CheckBuffer(py_coords))  // e.g. NumPy arrays, memoryviews
+        return evalBuffer(py_coords, PyTuple_Size(args) > 1 ? PyTuple_GetItem(args, 1) /* borrowed */ : nullptr);
+      static std::vector<double> coords, weights;  // buffers re-used between calls
+      const auto num_points = fillCoordinates(py_coords, coords);
+      if (num_points == 0)  // single point
+        return python::ObjectPtr::make<double>(gIntegrand->eval(coords.data())).release();
+      weights.resize(num_points);
+      evalPoints(coords.data(), num_points, weights.data());
+      return python::ObjectPtr::make(weights).release();
+    }
+    /// Evaluate a batch of points held in a buffer, without any per-element conversion
+    /// \return Output buffer if provided, or a new memoryview of N doubles
+    static PyObject* evalBuffer(PyObject* py_coords, PyObject* py_out) {
+      using buffer_ptr = std::unique_ptr<Py_buffer, void (*)(Py_buffer*)>;
+      const auto ndim = gIntegrand->size();
+      Py_buffer in_view;
+      if (PyObject_GetBuffer(py_coords, &in_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+        throw PY_ERROR << "Coordinates buffer must be C-contiguous.";
+      buffer_ptr in(&in_view, PyBuffer_Release);
+      checkFormat(*in, "coordinates");
+      if (in->ndim < 1 || in->ndim > 2 || in->shape[in->ndim - 1] != (Py_ssize_t)ndim)
+        throw CG_FATAL("PythonIntegrator") << "Invalid coordinates buffer shape: expected (N, " << ndim
+                                           << "), received a " << in->ndim << "-dimensional buffer.";
+      const auto* coords = static_cast<const double*>(in->buf);
+      if (in->ndim == 1)  // single point
+        return python::ObjectPtr::make<double>(gIntegrand->eval(coords)).release();
+      const size_t num_points = in->shape[0];
+      if (py_out && py_out != Py_None) {  // fill the user-provided output buffer
+        Py_buffer out_view;
+        if (PyObject_GetBuffer(py_out, &out_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | PyBUF_WRITABLE) < 0)
+          throw PY_ERROR << "Output buffer must be writable and C-contiguous.";
+        buffer_ptr out(&out_view, PyBuffer_Release);
+        checkFormat(*out, "output");
+        if ((size_t)(out->len / out->itemsize) != num_points)
+          throw CG_FATAL("PythonIntegrator") << "Invalid output buffer size: expected " << num_points
+                                             << ", received " << out->len / out->itemsize << ".";
+        evalPoints(coords, num_points, static_cast<double*>(out->buf));
+        Py_INCREF(py_out);
+        return py_out;
+      }
+      python::ObjectPtr weights(PyByteArray_FromStringAndSize(nullptr, num_points * sizeof(double)));
+      if (!weights)
+        throw PY_ERROR << "Failed to allocate the output buffer for " << num_points << " points.";
+      evalPoints(coords, num_points, reinterpret_cast<double*>(PyByteArray_AsString(weights.get())));
+      python::ObjectPtr view(PyMemoryView_FromObject(weights.get()));
+      if (!view)
+        throw PY_ERROR << "Failed to build a view on the output buffer.";
+      auto* out = PyObject_CallMethod(view.get(), "cast", "s", "d");
+      if (!out)
+        throw PY_ERROR << "Failed to cast the output buffer to double-precision values.";
+      return out;
+    }
+    /// Ensure a buffer holds native double-precision values
+    static void checkFormat(const Py_buffer& buffer, const std::string& name) {
+      const std::string format = buffer.format ? buffer.format : "B";
+      if (buffer.itemsize != sizeof(double) || (format != "d" && format != "@d" && format != "=d"))
+        throw CG_FATAL("PythonIntegrator") << "Invalid " << name << " buffer format: '" << format
+                                           << "'. Double-precision values are expected.";
+    }
+    /// Evaluate a flat, row-major batch of points, split among the integrand copies if any
+    static void evalPoints(const double* coords, size_t num_points, double* weights) {
+      const size_t num_workers = gClones.size() + 1;
+      if (num_workers == 1 || num_points < 2 * num_workers) {  // single integrand: evaluated with the GIL held
+        gIntegrand->evalBatch(coords, num_points, weights);
+        return;
+      }
+      const auto ndim = gIntegrand->size();
+      const size_t slice = (num_points + num_workers - 1) / num_workers;
+      std::vector<std::exception_ptr> exceptions(num_workers);
+      auto eval_slice = [&](Integrand& integrand, size_t iw) {
+        try {
+          const auto first = iw * slice;
+          if (first < num_points)
+            integrand.evalBatch(coords + first * ndim, std::min(slice, num_points - first), weights + first);
+        } catch (...) {
+          exceptions[iw] = std::current_exception();
+        }
+      };
+      // the integrand evaluation does not involve the Python interpreter; the GIL is only released here, while each
+      // thread owns a distinct integrand copy, and re-acquired once all threads joined
+      Py_BEGIN_ALLOW_THREADS;
+      std::vector<std::thread> threads;
+      for (size_t iw = 1; iw < num_workers; ++iw)
+        threads.emplace_back(eval_slice, std::ref(*gClones.at(iw - 1)), iw);
+      eval_slice(*gIntegrand, 0);
+      for (auto& thread : threads)
+        thread.join();
+      Py_END_ALLOW_THREADS;
+      for (const auto& exception : exceptions)
+        if (exception)
+          std::rethrow_exception(exception);
+    }
+    /// Unpack a (batch of) point(s) into a flat, row-major coordinates buffer
+    /// \return Number of points in the batch, or 0 for a single point
+    static size_t fillCoordinates(PyObject* obj, std::vector<double>& coords) {
+      const auto size = [](PyObject* seq) -> Py_ssize_t {
+        if (PyTuple_Check(seq))
+          return PyTuple_Size(seq);
+        if (PyList_Check(seq))
+          return PyList_Size(seq);
+        throw CG_FATAL("PythonIntegrator") << "Invalid coordinates type: \"" << seq->ob_type->tp_name << "\".";
+      };
+      const auto item = [](PyObject* seq, Py_ssize_t i) -> PyObject* {
+        return PyTuple_Check(seq) ? PyTuple_GetItem(seq, i) : PyList_GetItem(seq, i);  // borrowed
+      };
+      const auto ndim = gIntegrand->size();
+      const auto num_entries = size(obj);
+      const bool batch = num_entries > 0 && (PyTuple_Check(item(obj, 0)) || PyList_Check(item(obj, 0)));
+      const size_t num_points = batch ? num_entries : 1;
+      coords.resize(num_points * ndim);
+      for (size_t i = 0; i < num_points; ++i) {
+        auto* point = batch ? item(obj, i) : obj;
+        if ((size_t)size(point) != ndim)
+          throw CG_FATAL("PythonIntegrator") << "Invalid coordinates multiplicity: expected(" << ndim
+                                             << ") != received(" << size(point) << ")!";
+        for (size_t j = 0; j < ndim; ++j)
+          coords[i * ndim + j] = PyFloat_AsDouble(item(point, j));
+      }
+      return batch ? num_points : 0;
     }
   };
   Integrand* PythonIntegrator::gIntegrand = nullptr;
+  std::vector<std::unique_ptr<Integrand> > PythonIntegrator::gClones;
+  std::atomic<std::thread::id> PythonIntegrator::gOwner;
 }  // namespace cepgen
 
 REGISTER_INTEGRATOR("python", PythonIntegrator);
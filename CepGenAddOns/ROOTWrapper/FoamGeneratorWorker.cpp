@@ -85,9 +85,9 @@ namespace cepgen {
     }
 
     /// Compute the weight for a given phase space point
-    inline double Density(int ndim, double* x) override {
+    inline double Density(int, double* x) override {
       if (integrand_)
-        return integrand_->eval(std::vector<double>(x, x + ndim));
+        return integrand_->eval(x);
       throw CG_FATAL("FoamGeneratorWorker:density") << "Integrand object was not initialised!";
     }
 
@@ -106,7 +106,7 @@ namespace cepgen {
         throw CG_FATAL("FoamDensity") << "Integrand object not yet initialised!";
       for (int i = 0; i < ndim; ++i)
         coord_[i] = limits_.at(i).x(x[i]);
-      return integrand_->eval(coord_);
+      return integrand_->eval(coord_.data());
     }
 
   private:
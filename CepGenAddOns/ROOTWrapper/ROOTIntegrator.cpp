@@ -92,13 +92,11 @@ namespace cepgen {
       checkLimits(integrand);
 
       if (integrand.size() == 1) {
-        auto funct = [&](double x) -> double { return integrand.eval(std::vector<double>{x}); };
+        auto funct = [&](double x) -> double { return integrand.eval(&x); };
         integr_1d_->SetFunction(funct);
         return Value{integr_1d_->Integral(limits_.at(0).min(), limits_.at(0).max()), integr_1d_->Error()};
       }
-      auto funct = [&](const double* x) -> double {
-        return integrand.eval(std::vector<double>(x, x + integrand.size()));
-      };
+      auto funct = [&](const double* x) -> double { return integrand.eval(x); };
       integr_->SetFunction(funct, integrand.size());
       return Value{integr_->Integral(xlow_.data(), xhigh_.data()), integr_->Error()};
     }
@@ -63,6 +63,7 @@ namespace cepgen {
     double uniform(double min, double max) override { return rng_->Uniform(min, max); }
     double normal(double mean, double rms) override { return rng_->Gaus(mean, rms); }
     double exponential(double exponent) override { return rng_->Exp(exponent); }
+    void setSeed(unsigned long long seed) override { rng_->SetSeed(seed_ = seed); }
 
   private:
     void* enginePtr() override { return rng_.get(); }
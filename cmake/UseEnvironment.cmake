@@ -52,6 +52,9 @@ else()
   list(APPEND CEPGEN_CORE_EXT ${GSL_CBLAS_LIB})
 endif()
 include_directories(${GSL_INCLUDE})
+#--- searching for threading library (multi-threaded events generation)
+find_package(Threads REQUIRED)
+list(APPEND CEPGEN_CORE_EXT Threads::Threads)
 #--- searching for ROOT
 find_package(ROOT QUIET)
 if(ROOT_FOUND)
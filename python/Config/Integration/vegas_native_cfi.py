@@ -0,0 +1,13 @@
+from Config.containers_cff import Module
+
+vegas_native = Module('vegas_native',
+    numFunctionCalls = 100000,  # per round of iterations
+    iterations = 10,
+    chiSqCut = 1.5,
+    treat = True,  # smoothing of the integrand
+    # VEGAS+-specific parameters
+    numIncrements = 100,
+    alpha = 0.5,  # map adaptation damping
+    beta = 0.75,  # stratification adaptation damping
+    numThreads = 0,  # all hardware threads
+)
@@ -0,0 +1,17 @@
+import numpy as np
+
+def integrate(f, num_dim: int, num_iter: int, num_warmup: int, num_calls: int, limits: list[tuple[float]]=[]):
+    limits = np.array(limits if len(limits) > 0 else num_dim * [(0., 1.)], dtype=np.float64)
+    jacob = np.prod(limits[:, 1] - limits[:, 0])
+    rng = np.random.default_rng()
+    # whole batch of points sampled and evaluated in a single call, through the (N, ndim) buffer
+    points = limits[:, 0] + rng.random((num_calls, num_dim)) * (limits[:, 1] - limits[:, 0])
+    weights = np.asarray(f(points))
+    return (jacob * weights.mean(), jacob * weights.std(ddof=1) / np.sqrt(num_calls))
+
+if __name__ == '__main__':
+    import math
+    def batch(func):
+        return lambda xs: np.array([func(x) for x in xs])
+    print(integrate(batch(lambda x: x[0]**2 + x[1]**2), 2, 10, 1000, 1000))
+    print(integrate(batch(lambda x: math.sin(x[0])), 1, 10, 1000, 1000, [(0, math.pi)]))
@@ -1,13 +1,26 @@
 from scipy import integrate as spint
 import numpy as np
 
-def integrate(f, num_dim: int, num_iter: int, num_warmup: int, num_calls: int, limits: list[tuple[float]]=[]):
+def integrate(f, num_dim: int, num_iter: int, num_warmup: int, num_calls: int, limits: list[tuple[float]]=[],
+              method: str='nquad'):
     limits = [[lim[0], lim[1]] for lim in (limits if len(limits) > 0 else num_dim * [[0., 1.]])]
+    if method == 'qmc_quad':  # vectorised quasi-Monte Carlo integration (SciPy >= 1.11)
+        def f_batch(xarr):
+            # whole batch of points evaluated in a single call, through the (N, ndim) buffer
+            return np.asarray(f(np.ascontiguousarray(xarr.T, dtype=np.float64)))
+        lower, upper = zip(*limits)
+        res = spint.qmc_quad(f_batch, lower, upper, n_estimates=max(num_iter, 2), n_points=num_calls)
+        return (res.integral, res.standard_error)
+    if method != 'nquad':
+        raise ValueError(f"Invalid SciPy integration method: '{method}'.")
     def f_args(*args):
         return f(args)
     return spint.nquad(f_args, limits)
 
 if __name__ == '__main__':
     import math
-    print(integrate(lambda x: x[0]**2 + x[1]**2, 2, 10, 1000, 1000))
-    print(integrate(lambda x: math.sin(x[0]), 1, 10, 1000, 1000, [(0, math.pi)]))
+    def batch(func):
+        return lambda xs: np.array([func(x) for x in xs]) if np.ndim(xs) > 1 else func(xs)
+    print(integrate(batch(lambda x: x[0]**2 + x[1]**2), 2, 10, 1000, 1000))
+    print(integrate(batch(lambda x: math.sin(x[0])), 1, 10, 1000, 1000, [(0, math.pi)]))
+    print(integrate(batch(lambda x: x[0]**2 + x[1]**2), 2, 10, 1000, 1000, method='qmc_quad'))
@@ -0,0 +1,4 @@
+from IntegrationAlgos import Scipy
+
+def integrate(f, num_dim: int, num_iter: int, num_warmup: int, num_calls: int, limits: list[tuple[float]]=[]):
+    return Scipy.integrate(f, num_dim, num_iter, num_warmup, num_calls, limits, method='qmc_quad')
@@ -2,13 +2,15 @@ import torch
 import numpy as np
 from torchquad import MonteCarlo, set_up_backend
 
-set_up_backend('torch', data_type='float32')
+set_up_backend('torch', data_type='float64')
 
 def integrate(f, num_dim: int, num_iter: int, num_warmup: int, num_calls: int, limits: list[tuple[float]]=[]):
     limits = limits if len(limits) > 0 else num_dim * [(0., 1.)]
 
     def func(xarr):
-        return torch.from_numpy(np.array([f([float(x) for x in xvals]) for xvals in xarr.numpy()]))
+        # whole batch of points evaluated in a single call, through the (N, ndim) buffer
+        weights = np.asarray(f(np.ascontiguousarray(xarr.numpy(), dtype=np.float64)))
+        return torch.from_numpy(weights)
 
     mc = MonteCarlo()
     res = mc.integrate(func, dim=num_dim, N=num_calls, integration_domain=limits, backend='torch')
@@ -16,5 +18,7 @@ def integrate(f, num_dim: int, num_iter: int, num_warmup: int, num_calls: int, l
 
 if __name__ == '__main__':
     import math
-    print(integrate(lambda x: x[0]**2 + x[1]**2, 2, 10, 1000, 1000))
-    print(integrate(lambda x: math.sin(x[0]), 1, 10, 1000, 1000, [(0, math.pi)]))
+    def batch(func):
+        return lambda xs: np.array([func(x) for x in xs])
+    print(integrate(batch(lambda x: x[0]**2 + x[1]**2), 2, 10, 1000, 1000))
+    print(integrate(batch(lambda x: math.sin(x[0])), 1, 10, 1000, 1000, [(0, math.pi)]))
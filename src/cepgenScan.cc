@@ -41,7 +41,7 @@ int main(int argc, char* argv[]) {
   int npoints;
   double min_value, max_value;
   vector<double> points;
-  bool draw_grid, logy;
+  bool draw_grid, logy, warm_start;
 
   cepgen::ArgumentsParser parser(argc, argv);
   parser.addArgument("config,i", "base configuration", &input_config)
@@ -54,6 +54,7 @@ int main(int argc, char* argv[]) {
       .addOptionalArgument("logy,l", "logarithmic y-scale", &logy, false)
       .addOptionalArgument("draw-grid,g", "draw the x/y grid", &draw_grid, false)
       .addOptionalArgument("plotter,p", "type of plotter to user", &plotter, "")
+      .addOptionalArgument("warm-start,w", "seed each point with the previous integration grid", &warm_start, false)
       .parse();
 
   cepgen::Generator mg;
@@ -74,6 +75,9 @@ int main(int argc, char* argv[]) {
   auto& par = mg.runParameters();
   //--- ensure nothing is written in the output sequence
   par.eventExportersSequence().clear();
+  //--- neighbouring points integration converges faster from an already adapted grid
+  if (warm_start)
+    par.integrator().set<bool>("warmStart", true);
 
   if (points.empty())
     for (int i = 0; i <= npoints; ++i)
@@ -0,0 +1,75 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Cards/Handler.h"
+#include "CepGen/Core/RunParameters.h"
+#include "CepGen/Event/Event.h"
+#include "CepGen/EventFilter/EventExporter.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+#include "CepGen/Utils/Value.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  string input_card;
+  int num_events;
+  double num_sigma;
+
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("config,i", "path to the configuration file", &input_card, "Cards/lpair_cfg.py")
+      .addOptionalArgument("num-events,n", "number of events to generate", &num_events, 2000)
+      .addOptionalArgument("num-sigma,s", "max. number of std.dev.", &num_sigma, 5.)
+      .parse();
+
+  // mean and standard error of the central system transverse momentum, for a given bins sampling strategy
+  auto central_pt = [&](bool alias_sampling) {
+    auto* run_params = cepgen::card::Handler::parseFile(input_card);
+    run_params->generation().setParameters(cepgen::ParametersList().set<cepgen::ParametersList>(
+        "worker",
+        cepgen::ParametersList()
+            .setName<std::string>("grid_optimised")
+            .set<bool>("aliasSampling", alias_sampling)));
+    cepgen::Generator gen;
+    gen.setRunParameters(run_params);
+    gen.runParameters().eventExportersSequence().clear();
+    size_t num_stored = 0;
+    double sum = 0., sum2 = 0.;
+    gen.generate(num_events, [&](const cepgen::Event& ev, size_t) {
+      cepgen::Momentum central;
+      for (const auto& part : ev(cepgen::Particle::Role::CentralSystem))
+        central += part.momentum();
+      sum += central.pt();
+      sum2 += central.pt() * central.pt();
+      ++num_stored;
+    });
+    CG_TEST_EQUAL(num_stored, (size_t)num_events, string(alias_sampling ? "alias" : "uniform") + " bins sampling");
+    const double mean = sum / num_stored;
+    return cepgen::Value{mean, sqrt((sum2 / num_stored - mean * mean) / num_stored)};
+  };
+
+  const auto pt_uniform = central_pt(false), pt_alias = central_pt(true);
+  CG_TEST(fabs((double)pt_uniform - (double)pt_alias) <=
+              num_sigma * hypot(pt_uniform.uncertainty(), pt_alias.uncertainty()),
+          "central system pT compatibility between bins sampling strategies");
+
+  CG_TEST_SUMMARY;
+}
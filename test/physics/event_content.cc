@@ -0,0 +1,93 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "CepGen/Event/Event.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  bool verbose;
+  int num_central;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("verbose,v", "verbose mode", &verbose, false)
+      .addOptionalArgument("num-central,n", "central system multiplicity", &num_central, 8)
+      .parse();
+  cepgen::initialise();
+  CG_TEST_DEBUG(verbose);
+
+  {  // identifiers list with inline and heap storage
+    cepgen::ParticlesIds ids{5, 1, 3};
+    CG_TEST_EQUAL(ids.size(), 3ul, "identifiers multiplicity");
+    CG_TEST(!ids.insert(3).second, "duplicate identifier rejection");
+    for (const auto& id : {9, 0, 7, 2})
+      ids.insert(id);
+    CG_TEST_EQUAL(ids.size(), 7ul, "identifiers multiplicity beyond inline storage");
+    CG_TEST(std::is_sorted(ids.begin(), ids.end()), "identifiers ordering");
+    CG_TEST_EQUAL(*ids.begin(), 0, "first identifier");
+    CG_TEST_EQUAL(*ids.rbegin(), 9, "last identifier");
+    CG_TEST_EQUAL(ids.erase(7) + ids.erase(9) + ids.erase(4), 2ul, "identifiers removal");
+    CG_TEST(ids == (cepgen::ParticlesIds{0, 1, 2, 3, 5}), "identifiers after removal");
+  }
+
+  auto evt = cepgen::Event::minimal(num_central);
+  CG_TEST_EQUAL(evt.size(), (size_t)(7 + num_central), "event multiplicity");
+  {  // identifier-based lookup
+    bool valid_ids = true;
+    for (size_t i = 0; i < evt.size(); ++i)
+      if (evt(i).id() != (int)i || evt[i].id() != (int)i)
+        valid_ids = false;
+    CG_TEST(valid_ids, "particles lookup by identifier");
+    const auto parts = evt.particles();
+    CG_TEST_EQUAL(parts.size(), evt.size(), "particles list multiplicity");
+    bool ordered = true;
+    for (size_t i = 0; i < parts.size(); ++i)
+      if (parts.at(i).id() != (int)i)
+        ordered = false;
+    CG_TEST(ordered, "particles list ordering");
+    CG_TEST_EQUAL(evt.stableParticles().size(), (size_t)(2 + num_central), "stable particles multiplicity");
+  }
+  {  // parentage
+    const auto& twopart = evt.oneWithRole(cepgen::Particle::Role::Intermediate);
+    CG_TEST_EQUAL(twopart.daughters().size(), (size_t)num_central, "two-parton system daughters multiplicity");
+    CG_TEST_EQUAL(evt.daughters(twopart).size(), (size_t)num_central, "two-parton system daughters retrieval");
+    CG_TEST_EQUAL(evt.mothers(twopart).size(), 2ul, "two-parton system mothers retrieval");
+  }
+  {  // lookup after event modification
+    evt.freeze();
+    const auto new_id = evt.addParticle(cepgen::Particle::Role::CentralSystem).get().id();
+    CG_TEST_EQUAL(evt(new_id).id(), new_id, "lookup of a newly added particle");
+    evt.restore();
+    CG_TEST_EQUAL(evt.size(), (size_t)(7 + num_central), "event multiplicity after restoration");
+    const auto copy = evt;
+    CG_TEST_EQUAL(copy(evt.size() - 1).id(), (int)evt.size() - 1, "lookup in a copied event");
+  }
+  {  // lookup after in-place modifications, and content of partially built events
+    const auto new_id = (int)evt.size() + 10;
+    evt[3].setId(new_id);
+    CG_TEST_EQUAL(evt(new_id).id(), new_id, "lookup of a particle with a modified identifier");
+    evt.map()[cepgen::Particle::Role::CentralSystem].emplace_back(cepgen::Particle::Role::CentralSystem);
+    CG_TEST_EQUAL(evt.particles().size(), evt.size(), "particles list multiplicity with unset identifiers");
+  }
+
+  CG_TEST_SUMMARY;
+}
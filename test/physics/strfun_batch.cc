@@ -0,0 +1,85 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/StructureFunctionsFactory.h"
+#include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/String.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  bool verbose;
+  vector<int> str_funs;
+  int num_points;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("verbose,v", "verbose mode", &verbose, false)
+      .addOptionalArgument("str-funs,s",
+                           "struct.functions modellings to test",
+                           &str_funs,
+                           vector<int>{11, 12, 13, 14, 101, 104, 202, 301})
+      .addOptionalArgument("num-points,n", "number of test points along each axis", &num_points, 20)
+      .parse();
+  cepgen::initialise();
+  CG_TEST_DEBUG(verbose);
+
+  vector<double> xbj, q2;
+  for (const auto& x : cepgen::Limits{1.e-4, 0.9}.generate(num_points, true))
+    for (const auto& q : cepgen::Limits{1.e-2, 1.e2}.generate(num_points, true))
+      xbj.emplace_back(x), q2.emplace_back(q);
+  xbj.emplace_back(1.5), q2.emplace_back(1.);  // invalid couple
+
+  for (const auto& str_fun : str_funs) {
+    auto sf = cepgen::StructureFunctionsFactory::get().build(str_fun);
+    vector<double> f2, fl;
+    sf->evalBatch(xbj, q2, f2, fl);
+    CG_TEST_EQUAL(f2.size(), xbj.size(), cepgen::utils::format("batch size for SF %d", str_fun));
+    bool same_values = true;
+    for (size_t i = 0; i < xbj.size() - 1; ++i) {
+      const auto f2_ref = sf->F2(xbj[i], q2[i]), fl_ref = sf->FL(xbj[i], q2[i]);
+      if (fabs(f2[i] - f2_ref) > 1.e-10 * max(fabs(f2_ref), 1.) ||
+          fabs(fl[i] - fl_ref) > 1.e-10 * max(fabs(fl_ref), 1.))
+        same_values = false;
+    }
+    CG_TEST(same_values, cepgen::utils::format("batch/single-point evaluations for SF %d", str_fun));
+    CG_TEST(f2.back() == 0. && fl.back() == 0., cepgen::utils::format("invalid couple for SF %d", str_fun));
+  }
+
+  {
+    auto sf = cepgen::StructureFunctionsFactory::get().build(202),
+         sf_ref = cepgen::StructureFunctionsFactory::get().build(202);
+    const auto fl = sf->FL(0.1, 5.);  // no prior F2 evaluation at this point
+    sf_ref->F2(0.1, 5.);
+    CG_TEST_EQUAL(fl, sf_ref->FL(0.1, 5.), "FL without prior F2 evaluation");
+
+    auto sf_tab = cepgen::StructureFunctionsFactory::get().build(
+        cepgen::ParametersList(sf->parameters())
+            .set<cepgen::ParametersList>("sigmaRatioTable", cepgen::ParametersList().set<bool>("enabled", true)));
+    double max_error = 0.;
+    for (size_t i = 0; i < xbj.size() - 1; ++i)
+      if (const auto fl_ref = sf->FL(xbj[i], q2[i]); fl_ref != 0.)
+        max_error = max(max_error, fabs(sf_tab->FL(xbj[i], q2[i]) / fl_ref - 1.));
+    CG_TEST(max_error < 1.e-2, "FL from a tabulated sigma(L/T) ratio");
+  }
+
+  CG_TEST_SUMMARY;
+}
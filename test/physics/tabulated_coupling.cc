@@ -0,0 +1,80 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/CouplingFactory.h"
+#include "CepGen/Physics/Coupling.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  bool verbose;
+  string coupling;
+  int num_points;
+  double tolerance;
+  string filename;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("verbose,v", "verbose mode", &verbose, false)
+      .addOptionalArgument("coupling,c", "alpha(EM) evolution algorithm to tabulate", &coupling, "running")
+      .addOptionalArgument("tolerance,t", "relative tolerance of the tabulation", &tolerance, 1.e-4)
+      .addOptionalArgument("num-points,n", "number of test points", &num_points, 500)
+      .addOptionalArgument("filename,f", "temporary table file", &filename, "test_tabulated_coupling.bin")
+      .parse();
+  cepgen::initialise();
+  CG_TEST_DEBUG(verbose);
+
+  const cepgen::Limits q_range{1.e-2, 1.e3};
+  auto alpha = cepgen::AlphaEMFactory::get().build(coupling);
+  const auto tab_params = cepgen::ParametersList()
+                              .setName<std::string>("tabulated")
+                              .set<cepgen::ParametersList>("coupling", alpha->parameters())
+                              .set<cepgen::Limits>("qRange", q_range)
+                              .set<double>("tolerance", tolerance)
+                              .set<std::string>("gridPath", filename);
+  fs::remove(filename);
+  auto alpha_tab = cepgen::AlphaEMFactory::get().build(tab_params);
+  CG_TEST(fs::exists(filename), "table file written");
+
+  double max_error = 0.;
+  for (const auto& q : q_range.generate(num_points, true))
+    max_error = max(max_error, fabs((*alpha_tab)(q) / (*alpha)(q) - 1.));
+  CG_TEST(max_error < 10. * tolerance, "tabulated coupling within tolerance");
+  CG_TEST_EQUIV((*alpha_tab)(1.e-4), (*alpha)(q_range.min()), "coupling frozen below the table range");
+  CG_TEST_EQUIV((*alpha_tab)(1.e5), (*alpha)(q_range.max()), "coupling frozen above the table range");
+  {
+    auto alpha_fallback =
+        cepgen::AlphaEMFactory::get().build(cepgen::ParametersList(tab_params).set<bool>("fallback", true));
+    CG_TEST_EQUAL((*alpha_fallback)(1.e5), (*alpha)(1.e5), "coupling outside the table range (fallback mode)");
+  }
+  {
+    auto alpha_reload = cepgen::AlphaEMFactory::get().build(tab_params);
+    bool same_values = true;
+    for (const auto& q : q_range.generate(num_points / 5, true))
+      if ((*alpha_reload)(q) != (*alpha_tab)(q))
+        same_values = false;
+    CG_TEST(same_values, "reloaded table values");
+  }
+  fs::remove(filename);
+
+  CG_TEST_SUMMARY;
+}
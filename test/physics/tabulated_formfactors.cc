@@ -0,0 +1,83 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/FormFactors/Parameterisation.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/FormFactorsFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "tabulation_checks.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  bool verbose;
+  int num_nodes, num_points;
+  double tolerance;
+  string filename;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("verbose,v", "verbose mode", &verbose, false)
+      .addOptionalArgument("tolerance,t", "relative tolerance of the tabulation", &tolerance, 1.e-3)
+      .addOptionalArgument("num-nodes,n", "number of nodes along the Q^2 axis", &num_nodes, 200)
+      .addOptionalArgument("num-points,p", "number of test points", &num_points, 200)
+      .addOptionalArgument("filename,f", "temporary table file", &filename, "test_tabulated_formfactors.bin")
+      .parse();
+  cepgen::initialise();
+  CG_TEST_DEBUG(verbose);
+
+  const cepgen::Limits q2_range{1.e-4, 1.e2};
+  const auto ff_params =
+      cepgen::ParametersList().setName<std::string>("InelasticNucleon").set<bool>("computeFM", true);
+  auto ff = cepgen::FormFactorsFactory::get().build(ff_params);
+  const auto table_params = cepgen::ParametersList()
+                                .set<bool>("enabled", true)
+                                .set<cepgen::Limits>("Q2range", q2_range)
+                                .set<int>("numNodes", num_nodes)
+                                .set<double>("tolerance", tolerance)
+                                .set<std::string>("gridPath", filename);
+  const auto tab_params = cepgen::ParametersList(ff_params).set<cepgen::ParametersList>("tabulation", table_params);
+  auto ff_tab =
+      build_tabulated([&tab_params]() { return cepgen::FormFactorsFactory::get().build(tab_params); }, {filename});
+
+  // test points shifted with respect to the table nodes
+  const auto points =
+      test_points({cepgen::Limits{q2_range.min() * 1.7, q2_range.max() * 0.8}.generate(num_points, true)});
+  check_tabulated_values(
+      points,
+      [&](const point_t& pt) { return (*ff)(pt.at(0)).FE; },
+      [&](const point_t& pt) { return (*ff_tab)(pt.at(0)).FE; },
+      tolerance,
+      "tabulated electric form factor");
+  check_tabulated_values(
+      points,
+      [&](const point_t& pt) { return (*ff)(pt.at(0)).FM; },
+      [&](const point_t& pt) { return (*ff_tab)(pt.at(0)).FM; },
+      tolerance,
+      "tabulated magnetic form factor");
+  CG_TEST_EQUAL(
+      (*ff_tab)(q2_range.max() * 5.).FE, (*ff)(q2_range.max() * 5.).FE, "form factor outside the table range");
+  {
+    auto ff_reload = cepgen::FormFactorsFactory::get().build(tab_params);
+    check_reloaded_values(ff_tab, ff_reload, points, [](const auto& ffs, const point_t& pt) {
+      const auto values = (*ffs)(pt.at(0));
+      return vector<double>{values.FE, values.FM};
+    });
+  }
+  fs::remove(filename);
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,84 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Generator.h"
+#include "CepGen/KTFluxes/KTFlux.h"
+#include "CepGen/Modules/PartonFluxFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "tabulation_checks.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  bool verbose;
+  string kt_flux;
+  vector<int> num_nodes;
+  int num_points;
+  double tolerance;
+  string filename;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("verbose,v", "verbose mode", &verbose, false)
+      .addOptionalArgument("kt-flux,k", "kT-factorised flux to tabulate", &kt_flux, "BudnevElastic")
+      .addOptionalArgument("tolerance,t", "relative tolerance of the tabulation", &tolerance, 1.e-2)
+      .addOptionalArgument("num-nodes,n", "number of nodes along each table axis", &num_nodes, vector<int>{50, 50, 1})
+      .addOptionalArgument("num-points,p", "number of test points along each axis", &num_points, 25)
+      .addOptionalArgument("filename,f", "temporary table file", &filename, "test_tabulated_kt_flux.bin")
+      .parse();
+  cepgen::initialise();
+  CG_TEST_DEBUG(verbose);
+
+  const cepgen::Limits x_range{1.e-4, 0.5}, kt2_range{1.e-3, 1.e2}, mx2_range{1.2, 1.e2};
+  auto flux = cepgen::KTFluxFactory::get().build(kt_flux);
+  const auto tab_params = cepgen::ParametersList()
+                              .setName<std::string>("Tabulated")
+                              .set<cepgen::ParametersList>("ktFlux", flux->parameters())
+                              .set<cepgen::Limits>("xRange", x_range)
+                              .set<cepgen::Limits>("kt2Range", kt2_range)
+                              .set<cepgen::Limits>("mx2Range", mx2_range)
+                              .set<std::vector<int> >("numNodes", num_nodes)
+                              .set<double>("tolerance", tolerance)
+                              .set<std::string>("gridPath", filename);
+  auto flux_tab =
+      build_tabulated([&tab_params]() { return cepgen::KTFluxFactory::get().build(tab_params); }, {filename});
+
+  // test points shifted with respect to the table nodes
+  const auto points =
+      test_points({cepgen::Limits{x_range.min() * 1.3, x_range.max() * 0.9}.generate(num_points, true),
+                   cepgen::Limits{kt2_range.min() * 1.7, kt2_range.max() * 0.8}.generate(num_points, true)});
+  const auto mx2 = sqrt(mx2_range.min() * mx2_range.max());
+  const auto flux_value = [&mx2](const auto& flx, const point_t& pt) { return flx->fluxMX2(pt.at(0), pt.at(1), mx2); };
+  check_tabulated_values(
+      points,
+      [&](const point_t& pt) { return flux_value(flux, pt); },
+      [&](const point_t& pt) { return flux_value(flux_tab, pt); },
+      tolerance,
+      "tabulated kT-factorised flux",
+      1.e-20);
+  CG_TEST_EQUAL(flux_tab->fluxMX2(x_range.max() * 1.5, 1., mx2),
+                flux->fluxMX2(x_range.max() * 1.5, 1., mx2),
+                "flux outside the table range");
+  {
+    auto flux_reload = cepgen::KTFluxFactory::get().build(tab_params);
+    check_reloaded_values(flux_tab, flux_reload, points, flux_value);
+  }
+  fs::remove(filename);
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,83 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/CollinearFluxes/CollinearFlux.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/PartonFluxFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "tabulation_checks.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  bool verbose;
+  string kt_flux;
+  int num_points, num_nodes;
+  double tolerance;
+  string filename;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("verbose,v", "verbose mode", &verbose, false)
+      .addOptionalArgument("kt-flux,k", "unintegrated flux to integrate", &kt_flux, "BudnevElastic")
+      .addOptionalArgument("tolerance,t", "relative tolerance of the tabulation", &tolerance, 1.e-2)
+      .addOptionalArgument("num-nodes,n", "number of nodes along each axis of the table", &num_nodes, 60)
+      .addOptionalArgument("num-points,p", "number of test points along each axis", &num_points, 25)
+      .addOptionalArgument("filename,f", "temporary table file", &filename, "test_tabulated_ktintegrated_flux.bin")
+      .parse();
+  cepgen::initialise();
+  CG_TEST_DEBUG(verbose);
+
+  const cepgen::Limits x_range{1.e-4, 0.5}, q2_range{1.e-4, 1.e2};
+  const auto flux_params =
+      cepgen::ParametersList()
+          .setName<std::string>("KTIntegrated")
+          .set<cepgen::ParametersList>("ktFlux", cepgen::ParametersList().setName<std::string>(kt_flux));
+  auto flux = cepgen::CollinearFluxFactory::get().build(flux_params);
+  const auto table_params = cepgen::ParametersList()
+                                .set<bool>("enabled", true)
+                                .set<cepgen::Limits>("xRange", x_range)
+                                .set<cepgen::Limits>("Q2range", q2_range)
+                                .set<std::vector<int> >("numNodes", {num_nodes, num_nodes})
+                                .set<double>("tolerance", tolerance)
+                                .set<std::string>("gridPath", filename);
+  const auto tab_params = cepgen::ParametersList(flux_params).set<cepgen::ParametersList>("tabulation", table_params);
+  const auto q2_filename = filename + ".Q2range", mx2_filename = filename + ".MX2range";
+  auto flux_tab = build_tabulated([&tab_params]() { return cepgen::CollinearFluxFactory::get().build(tab_params); },
+                                  {q2_filename, mx2_filename});
+
+  // test points shifted with respect to the table nodes
+  const auto points =
+      test_points({cepgen::Limits{x_range.min() * 1.3, x_range.max() * 0.9}.generate(num_points, true),
+                   cepgen::Limits{q2_range.min() * 1.7, q2_range.max() * 0.8}.generate(num_points, true)});
+  const auto flux_value = [](const auto& flx, const point_t& pt) { return flx->fluxQ2(pt.at(0), pt.at(1)); };
+  check_tabulated_values(
+      points,
+      [&](const point_t& pt) { return flux_value(flux, pt); },
+      [&](const point_t& pt) { return flux_value(flux_tab, pt); },
+      tolerance,
+      "tabulated kT-integrated flux");
+  CG_TEST_EQUAL(flux_tab->fluxQ2(x_range.max() * 1.5, 1.), flux->fluxQ2(x_range.max() * 1.5, 1.),
+                "flux outside the table range");
+  {
+    auto flux_reload = cepgen::CollinearFluxFactory::get().build(tab_params);
+    check_reloaded_values(flux_tab, flux_reload, points, flux_value);
+  }
+  fs::remove(q2_filename);
+  fs::remove(mx2_filename);
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,79 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/StructureFunctionsFactory.h"
+#include "CepGen/StructureFunctions/Parameterisation.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  bool verbose;
+  int str_fun, num_points;
+  double tolerance;
+  string filename;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("verbose,v", "verbose mode", &verbose, false)
+      .addOptionalArgument("str-fun,s", "struct.functions modelling to tabulate", &str_fun, 11)
+      .addOptionalArgument("tolerance,t", "relative tolerance of the tabulation", &tolerance, 1.e-3)
+      .addOptionalArgument("num-points,n", "number of test points along each axis", &num_points, 50)
+      .addOptionalArgument("filename,f", "temporary table file", &filename, "test_tabulated_strfun.bin")
+      .parse();
+  cepgen::initialise();
+  CG_TEST_DEBUG(verbose);
+
+  const cepgen::Limits xbj_range{1.e-4, 0.9}, q2_range{1.e-2, 1.e2};
+  auto sf = cepgen::StructureFunctionsFactory::get().build(str_fun);
+  const auto tab_params = cepgen::ParametersList()
+                              .setName<int>(501)
+                              .set<cepgen::ParametersList>("structureFunctions", sf->parameters())
+                              .set<cepgen::Limits>("xBjRange", xbj_range)
+                              .set<cepgen::Limits>("Q2range", q2_range)
+                              .set<double>("tolerance", tolerance)
+                              .set<std::string>("gridPath", filename);
+  fs::remove(filename);
+  auto sf_tab = cepgen::StructureFunctionsFactory::get().build(tab_params);
+  CG_TEST(fs::exists(filename), "table file written");
+
+  double max_error = 0.;
+  for (const auto& xbj : xbj_range.generate(num_points, true))
+    for (const auto& q2 : q2_range.generate(num_points, true)) {
+      const auto f2 = sf->F2(xbj, q2), f2_tab = sf_tab->F2(xbj, q2);
+      max_error = max(max_error, fabs(f2_tab - f2) / max(fabs(f2), 1.e-10));
+    }
+  CG_TEST(max_error < 10. * tolerance, "tabulated F2 within tolerance");
+  CG_TEST_EQUAL(sf_tab->F2(0.5, 1.e3), sf->F2(0.5, 1.e3), "F2 outside the table range");
+
+  {
+    auto sf_reload = cepgen::StructureFunctionsFactory::get().build(tab_params);
+    bool same_values = true;
+    for (const auto& xbj : xbj_range.generate(num_points / 5, true))
+      for (const auto& q2 : q2_range.generate(num_points / 5, true))
+        if (sf_reload->F2(xbj, q2) != sf_tab->F2(xbj, q2) || sf_reload->FL(xbj, q2) != sf_tab->FL(xbj, q2))
+          same_values = false;
+    CG_TEST(same_values, "reloaded table values");
+  }
+  fs::remove(filename);
+
+  CG_TEST_SUMMARY;
+}
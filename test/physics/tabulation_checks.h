@@ -0,0 +1,65 @@
+#include <cmath>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Test.h"
+
+namespace {
+  typedef std::vector<double> point_t;  ///< Test point coordinates
+
+  /// Build the test points set as the cartesian product of the test coordinates along each axis
+  inline std::vector<point_t> test_points(const std::vector<std::vector<double> >& axes) {
+    std::vector<point_t> points{{}};
+    for (const auto& axis : axes) {
+      std::vector<point_t> expanded;
+      for (const auto& point : points)
+        for (const auto& coord : axis) {
+          expanded.emplace_back(point);
+          expanded.back().emplace_back(coord);
+        }
+      points = std::move(expanded);
+    }
+    return points;
+  }
+
+  /// Remove any previously cached table, build the tabulated object, and check its table files are written
+  template <typename F>
+  inline auto build_tabulated(const F& build, const std::vector<std::string>& filenames) {
+    for (const auto& filename : filenames)
+      fs::remove(filename);
+    auto tabulated = build();
+    bool written = true;
+    for (const auto& filename : filenames)
+      written = written && fs::exists(filename);
+    CG_TEST(written, "table files written");
+    return tabulated;
+  }
+
+  /// Check the maximal relative deviation of a tabulated quantity to its exact value over a set of test points
+  /// \param[in] min_value minimal exact value (in magnitude) for a test point to be considered
+  inline void check_tabulated_values(const std::vector<point_t>& points,
+                                     const std::function<double(const point_t&)>& exact,
+                                     const std::function<double(const point_t&)>& tabulated,
+                                     double tolerance,
+                                     const std::string& name,
+                                     double min_value = 0.) {
+    double max_error = 0.;
+    for (const auto& point : points)
+      if (const auto exact_value = exact(point); std::fabs(exact_value) > min_value)
+        max_error = std::max(max_error, std::fabs(tabulated(point) / exact_value - 1.));
+    CG_TEST(max_error < 10. * tolerance, name + " within tolerance");
+  }
+
+  /// Check that a table reloaded from its cache file yields the very same values as the freshly tabulated one
+  /// \param[in] values all quantities to be compared for a tabulated object at a test point
+  template <typename T, typename F>
+  inline void check_reloaded_values(T& tabulated, T& reloaded, const std::vector<point_t>& points, const F& values) {
+    bool same_values = true;
+    for (const auto& point : points)
+      if (values(reloaded, point) != values(tabulated, point))
+        same_values = false;
+    CG_TEST(same_values, "reloaded table values");
+  }
+}  // namespace
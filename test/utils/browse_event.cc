@@ -40,7 +40,10 @@ int main(int argc, char* argv[]) {
       {"m(7,8)", (evt(7).momentum() + evt(8).momentum()).mass()}};
 
   const cepgen::utils::EventBrowser bws;
-  for (const auto& val_pair : values)
+  for (const auto& val_pair : values) {
     CG_TEST_EQUIV(bws.get(evt, val_pair.first), val_pair.second, val_pair.first);
+    CG_TEST_EQUIV(bws.get(evt, val_pair.first), val_pair.second, val_pair.first + " (cached)");
+    CG_TEST_EQUIV(bws.compile(val_pair.first)(evt), val_pair.second, val_pair.first + " (compiled)");
+  }
   CG_TEST_SUMMARY;
 }
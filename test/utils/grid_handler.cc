@@ -0,0 +1,160 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <thread>
+
+#include "CepGen/Generator.h"
+#include "CepGen/Modules/RandomGeneratorFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/GridHandler.h"
+#include "CepGen/Utils/RandomGenerator.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  bool verbose;
+  int num_points, num_threads;
+  string filename;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("verbose,v", "verbose mode", &verbose, false)
+      .addOptionalArgument("num-points,n", "number of points to interpolate", &num_points, 1000)
+      .addOptionalArgument("num-threads,t", "number of concurrent threads", &num_threads, 4)
+      .addOptionalArgument("filename,f", "temporary grid cache file", &filename, "test_grid_handler.cgcache")
+      .parse();
+  cepgen::initialise();
+  CG_TEST_DEBUG(verbose);
+
+  auto rng = cepgen::RandomGeneratorFactory::get().build("stl");
+  {  // a multilinear function is exactly reproduced by a trilinear interpolation
+    const auto func = [](double x, double y, double z) { return 1. + 2. * x - 3. * y + 0.5 * z + x * y * z; };
+    cepgen::GridHandler<3, 1> grid(cepgen::GridType::linear), grid_clamped(cepgen::GridType::linear, true);
+    for (const auto& x : {0., 0.3, 1.})
+      for (const auto& y : {-1., 0., 2., 5.})
+        for (const auto& z : {1., 2.}) {
+          grid.insert({x, y, z}, {func(x, y, z)});
+          grid_clamped.insert({x, y, z}, {func(x, y, z)});
+        }
+    grid.initialise();
+    grid_clamped.initialise();
+    double max_diff = 0.;
+    for (int i = 0; i < num_points; ++i) {
+      const auto x = rng->uniform(0., 1.), y = rng->uniform(-1., 5.), z = rng->uniform(1., 2.);
+      max_diff = max(max_diff, fabs(grid.eval({x, y, z})[0] - func(x, y, z)));
+    }
+    CG_TEST_EQUIV(max_diff, 0., "trilinear interpolation");
+    CG_TEST_EQUAL(grid.eval({5., 10., 3.})[0], 0., "zero value above the grid boundaries");
+    CG_TEST_EQUAL(grid.eval({0.5, -10., 1.5})[0], 0., "zero value below the grid boundaries");
+    CG_TEST_EQUIV(grid_clamped.eval({5., 10., 3.})[0], func(1., 5., 2.), "clamping above the grid boundaries");
+    CG_TEST_EQUIV(grid_clamped.eval({-5., -10., 0.})[0], func(0., -1., 1.), "clamping below the grid boundaries");
+    const vector<double> coord{0.3, 2., 1.};
+    CG_TEST_EQUAL(grid.eval(coord)[0], func(0.3, 2., 1.), "evaluation from a dynamic-size coordinates container");
+    CG_TEST_EXCEPT([&grid]() { grid.eval(vector<double>{0.3, 2.}); }, "evaluation from too few coordinates");
+    CG_TEST_EXCEPT([&grid]() { grid.eval(vector<double>{0.3, 2., 1., 4.}); }, "evaluation from too many coordinates");
+
+    vector<array<double, 3> > points;
+    for (int i = 0; i < num_points; ++i)
+      points.push_back({rng->uniform(0., 1.), rng->uniform(-1., 5.), rng->uniform(1., 2.)});
+    vector<vector<double> > results(num_threads, vector<double>(points.size()));
+    vector<thread> threads;
+    for (int i = 0; i < num_threads; ++i)
+      threads.emplace_back([&grid, &points, &res = results[i]]() {
+        for (size_t j = 0; j < points.size(); ++j)
+          res[j] = grid.eval(points[j])[0];
+      });
+    for (auto& thr : threads)
+      thr.join();
+    bool same_values = true;
+    for (size_t j = 0; j < points.size(); ++j)
+      for (const auto& res : results)
+        if (res[j] != grid.eval(points[j])[0])
+          same_values = false;
+    CG_TEST(same_values, "concurrent evaluations");
+
+    const size_t key = 42;
+    CG_TEST(grid.save(filename, key), "grid cache writing");
+    {
+      cepgen::GridHandler<3, 1> grid_in(cepgen::GridType::linear);
+      CG_TEST(grid_in.load(filename, key), "grid cache retrieval");
+      bool same_cached_values = true;
+      for (const auto& point : points)
+        if (grid_in.eval(point)[0] != grid.eval(point)[0])
+          same_cached_values = false;
+      CG_TEST(same_cached_values, "values retrieved from the grid cache");
+      CG_TEST_EQUAL(grid_in.values().size(), grid.values().size(), "number of nodes retrieved from the grid cache");
+    }
+    {
+      cepgen::GridHandler<3, 1> grid_in(cepgen::GridType::linear);
+      CG_TEST(!grid_in.load(filename, key + 1), "grid cache rejection for a different configuration");
+    }
+    {
+      cepgen::GridHandler<3, 1> grid_in(cepgen::GridType::logarithmic);
+      CG_TEST(!grid_in.load(filename, key), "grid cache rejection for a different coordinates type");
+    }
+    fs::remove(filename);
+  }
+  {  // bilinear interpolation in logarithmic coordinates
+    cepgen::GridHandler<2, 2> grid(cepgen::GridType::logarithmic);
+    for (const auto& x : {1.e-3, 1.e-2, 1.e-1})
+      for (const auto& y : {1., 10., 100.})
+        grid.insert({x, y}, {log10(x) + log10(y), 2.});
+    grid.initialise();
+    const auto vals = grid.eval({sqrt(1.e-5), 30.});
+    CG_TEST_EQUIV(vals[0], log10(sqrt(1.e-5)) + log10(30.), "bilinear interpolation (first value)");
+    CG_TEST_EQUIV(vals[1], 2., "bilinear interpolation (second value)");
+  }
+  {  // cubic spline interpolation, with one lookup accelerator per evaluating thread
+    const auto func = [](double x) { return x * x * x - 2. * x; };
+    cepgen::GridHandler<1, 1> grid(cepgen::GridType::linear), grid_clamped(cepgen::GridType::linear, true);
+    for (const auto& x : cepgen::Limits{-1., 2.}.generate(200)) {
+      grid.insert({x}, {func(x)});
+      grid_clamped.insert({x}, {func(x)});
+    }
+    grid.initialise();
+    grid_clamped.initialise();
+    vector<double> points;
+    for (int i = 0; i < num_points; ++i)
+      points.emplace_back(rng->uniform(-1., 2.));
+    double max_diff = 0.;
+    for (const auto& x : points)
+      max_diff = max(max_diff, fabs(grid.eval({x})[0] - func(x)));
+    CG_TEST(max_diff < 1.e-4, "cubic spline interpolation");
+    CG_TEST_EQUAL(grid.eval({3.})[0], 0., "zero value outside the spline boundaries");
+    CG_TEST_EQUIV(grid_clamped.eval({3.})[0], func(2.), "clamping outside the spline boundaries");
+
+    vector<vector<double> > results(num_threads, vector<double>(points.size()));
+    vector<thread> threads;
+    for (int i = 0; i < num_threads; ++i)
+      threads.emplace_back([&grid, &grid_clamped, &points, &res = results[i]]() {
+        for (size_t j = 0; j < points.size(); ++j)  // alternate between two grids sharing the thread accelerator
+          res[j] = grid.eval({points[j]})[0] - grid_clamped.eval({points[points.size() - 1 - j]})[0];
+      });
+    for (auto& thr : threads)
+      thr.join();
+    bool same_values = true;
+    for (size_t j = 0; j < points.size(); ++j)
+      for (const auto& res : results)
+        if (res[j] != grid.eval({points[j]})[0] - grid_clamped.eval({points[points.size() - 1 - j]})[0])
+          same_values = false;
+    CG_TEST(same_values, "concurrent spline evaluations");
+  }
+
+  CG_TEST_SUMMARY;
+}
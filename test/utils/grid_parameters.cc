@@ -0,0 +1,66 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CepGen/Integration/GridParameters.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  bool verbose;
+  string filename;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("verbose", "verbose mode", &verbose, false)
+      .addOptionalArgument("filename,f", "temporary grid file", &filename, "test_grid_parameters.bin")
+      .parse();
+  CG_TEST_DEBUG(verbose);
+
+  const size_t key = 42;
+  cepgen::GridParameters grid(3, 4);
+  for (size_t i = 0; i < grid.size(); ++i)
+    grid.setValue(i, 0.5 * i);
+  grid.increment(2);
+  grid.setNumPoints(5, 2.25);  // fractional number of trials, e.g. for non-uniform bins selection
+  grid.setPrepared(true);
+  grid.save(filename, key);
+  {
+    cepgen::GridParameters grid_in(3, 4);
+    CG_TEST(grid_in.load(filename, key), "grid retrieval");
+    CG_TEST(grid_in.prepared(), "retrieved grid is prepared");
+    CG_TEST_EQUAL(grid_in.globalMax(), grid.globalMax(), "global maximum");
+    bool same_values = true;
+    for (size_t i = 0; i < grid.size(); ++i)
+      if (grid_in.maxValue(i) != grid.maxValue(i) || grid_in.numPoints(i) != grid.numPoints(i))
+        same_values = false;
+    CG_TEST(same_values, "per-bin maxima and number of points");
+  }
+  {
+    cepgen::GridParameters grid_in(3, 4);
+    CG_TEST(!grid_in.load(filename, key + 1), "grid rejection for a different configuration");
+    CG_TEST(!grid_in.prepared(), "rejected grid is not prepared");
+  }
+  {
+    cepgen::GridParameters grid_in(2, 4);
+    CG_TEST(!grid_in.load(filename, key), "grid rejection for a different binning");
+  }
+  fs::remove(filename);
+
+  CG_TEST_SUMMARY;
+}
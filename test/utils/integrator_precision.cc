@@ -0,0 +1,59 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Core/ParametersList.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Integration/FunctionIntegrand.h"
+#include "CepGen/Integration/Integrator.h"
+#include "CepGen/Modules/IntegratorFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+  double target_precision, num_sigma;
+  vector<string> integrators;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("precision,p", "target relative precision", &target_precision, 5.e-3)
+      .addOptionalArgument("num-sigma,n", "max. number of std.dev.", &num_sigma, 5.)
+      .addOptionalArgument("integrators,i", "list of integrators to test", &integrators,
+                           vector<string>{"vegas_native", "Vegas"})
+      .parse();
+  cepgen::initialise();
+
+  // (1 + x) * exp(-(y - 0.5)^2 / 0.02) over the unit square
+  const double exact = 1.5 * sqrt(M_PI * 0.02) * erf(0.5 / sqrt(0.02));
+  auto integrand = cepgen::FunctionIntegrand(
+      2, [](const vector<double>& x) { return (1. + x[0]) * exp(-pow(x[1] - 0.5, 2) / 0.02); });
+
+  for (const auto& name : integrators) {
+    const auto result = cepgen::IntegratorFactory::get()
+                            .build(cepgen::ParametersList()
+                                       .setName<string>(name)
+                                       .set<double>("targetPrecision", target_precision)
+                                       .set<double>("maxWallTime", 60.))
+                            ->integrate(integrand);
+    CG_TEST(result.relativeUncertainty() <= target_precision, name + " target precision reached");
+    CG_TEST(fabs((double)result - exact) <= num_sigma * result.uncertainty(), name + " compatibility with exact value");
+  }
+
+  CG_TEST_SUMMARY;
+}
@@ -0,0 +1,100 @@
+/*
+ *  CepGen: a central exclusive processes event generator
+ *  Copyright (C) 2024  Laurent Forthomme
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include "CepGen/Core/ParametersList.h"
+#include "CepGen/Generator.h"
+#include "CepGen/Integration/Integrand.h"
+#include "CepGen/Integration/NativeVegasIntegrator.h"
+#include "CepGen/Modules/IntegratorFactory.h"
+#include "CepGen/Utils/ArgumentsParser.h"
+#include "CepGen/Utils/Filesystem.h"
+#include "CepGen/Utils/Test.h"
+
+using namespace std;
+
+/// A peaked integrand (product of normalised gaussians), which may be cloned for concurrent evaluations
+class GaussianIntegrand final : public cepgen::Integrand {
+public:
+  explicit GaussianIntegrand(size_t ndim) : ndim_(ndim) {}
+
+  using cepgen::Integrand::eval;
+  double eval(const double* x) override {
+    double out = 1.;
+    for (size_t i = 0; i < ndim_; ++i)
+      out *= exp(-0.5 * pow((x[i] - 0.5) / kSigma, 2)) / (sqrt(2. * M_PI) * kSigma);
+    return out;
+  }
+  size_t size() const override { return ndim_; }
+  std::unique_ptr<cepgen::Integrand> clone() const override {
+    return std::unique_ptr<cepgen::Integrand>(new GaussianIntegrand(ndim_));
+  }
+
+private:
+  static constexpr double kSigma = 0.05;
+  const size_t ndim_;
+};
+
+int main(int argc, char* argv[]) {
+  int num_dim, num_threads;
+  double num_sigma;
+  string filename;
+  cepgen::ArgumentsParser(argc, argv)
+      .addOptionalArgument("num-dim,d", "integration dimension", &num_dim, 4)
+      .addOptionalArgument("num-threads,t", "number of concurrent threads", &num_threads, 4)
+      .addOptionalArgument("num-sigma,n", "max. number of std.dev.", &num_sigma, 5.)
+      .addOptionalArgument("filename,f", "temporary state file", &filename, "test_vegas_native.bin")
+      .parse();
+  cepgen::initialise();
+
+  auto build = [](int threads) {
+    return cepgen::IntegratorFactory::get().build(
+        cepgen::ParametersList()
+            .setName<std::string>("vegas_native")
+            .set<int>("numThreads", threads)
+            .set<cepgen::ParametersList>(
+                "randomGenerator",
+                cepgen::ParametersList().setName<std::string>("stl").set<unsigned long long>("seed", 42ull)));
+  };
+  GaussianIntegrand integrand(num_dim);
+
+  auto integr_single = build(1), integr_multi = build(num_threads);
+  const auto res_single = integr_single->integrate(integrand), res_multi = integr_multi->integrate(integrand);
+  CG_TEST_VALUES(1., res_multi, num_sigma, "multi-threaded integral");
+  CG_TEST_EQUAL((double)res_single, (double)res_multi, "result independent of the number of threads");
+  CG_TEST_EQUAL(res_single.uncertainty(), res_multi.uncertainty(), "uncertainty independent of the number of threads");
+  CG_TEST_EQUAL(integr_single->stateHash(), integr_multi->stateHash(), "grid independent of the number of threads");
+
+  {
+    const auto& state = dynamic_cast<const cepgen::NativeVegasIntegrator&>(*integr_multi).state();
+    state.save(filename);
+    cepgen::NativeVegasIntegrator::State reloaded;
+    CG_TEST(reloaded.load(filename), "state file loaded");
+    CG_TEST(reloaded.edges == state.edges, "reloaded map increments");
+    CG_TEST(reloaded.strata_weights == state.strata_weights, "reloaded stratification");
+
+    auto integr_seeded = cepgen::IntegratorFactory::get().build(
+        cepgen::ParametersList().setName<std::string>("vegas_native").set<std::string>("gridInput", filename));
+    const auto res_seeded = integr_seeded->integrate(integrand);
+    CG_TEST_VALUES(1., res_seeded, num_sigma, "integral from a reloaded state");
+  }
+  fs::remove(filename);
+
+  CG_TEST_SUMMARY;
+}